@@ -4,36 +4,89 @@
 
 #pragma once
 
+#include <Model/EmulationThread.hpp>
 #include <Model/I8086.hpp>
 
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 namespace i8086
 {
 
+	/**
+	 * @brief UI side of the CPU: commands go to the emulation thread, state comes from its snapshots.
+	 */
 	class CPUController
 	{
 	
 	public:
 
-		CPUController(I8086* const cpu) : mCPU(cpu)
+		/**
+		 * @details
+		 * Reads the initial state straight from the CPU, must be built before the emulation thread starts.
+		 */
+		CPUController(I8086* const cpu, EmulationThread* const emulation) : mEmulation(emulation)
 		{
-			if (!mCPU)
+			if (!cpu || !mEmulation)
 			{
 				throw std::runtime_error("CPU is not initialized.");
 			}
 
-			mCPU->GetInternalState(mInitialState);
+			cpu->GetInternalState(mInitialState);
 		}
 
-		void SetBreakpoint(u32 address, bool state) const
+		void SetBreakpoint(u32 address, bool state)
 		{
-			mCPU->SetBreakpoint(address, state);
+			const auto it = std::find(mBreakpoints.begin(), mBreakpoints.end(), address);
+
+			if (state && it == mBreakpoints.end())
+			{
+				mBreakpoints.push_back(address);
+			}
+
+			else if (!state && it != mBreakpoints.end())
+			{
+				mBreakpoints.erase(it);
+			}
+
+			mEmulation->SetBreakpoint(address, state);
+		}
+
+		/**
+		 * @brief Answered from the breakpoints set through this controller, without asking the emulation thread.
+		 */
+		bool HasBreakpoint(u32 address) const
+		{
+			return std::find(mBreakpoints.begin(), mBreakpoints.end(), address) != mBreakpoints.end();
+		}
+
+		void Step(u32 count = 1) const
+		{
+			mEmulation->Step(count);
+		}
+
+		void Run() const
+		{
+			mEmulation->Run();
+		}
+
+		void Pause() const
+		{
+			mEmulation->Pause();
+		}
+
+		bool IsRunning() const
+		{
+			return mEmulation->GetSnapshot().Running;
 		}
 
+		/**
+		 * @brief CPU state of the latest snapshot taken by the UI.
+		 */
 		void GetState(CPUState& state) const
 		{
-			return mCPU->GetInternalState(state);
+			state = mEmulation->GetSnapshot().State;
 		}
 
 		const CPUState& GetInitialState() const
@@ -43,8 +96,9 @@ namespace i8086
 
 	private:
 
-		I8086* const mCPU{ nullptr };
+		EmulationThread* const mEmulation{ nullptr };
 		CPUState mInitialState{};
+		std::vector<u32> mBreakpoints;
 	};
 
-} // namespace i8086
\ No newline at end of file
+} // namespace i8086
@@ -0,0 +1,54 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Model/Token.hpp>
+
+#include <imgui.h>
+
+#include <array>
+#include <cstddef>
+
+namespace UI
+{
+
+	struct ColorTheme
+	{
+		static constexpr size_t TOKEN_TYPE_COUNT = disassembler::tMinus + 1;
+
+		ImVec4 AddressColor;
+		ImVec4 BytesColor;
+		ImU32 BreakpointHoveredColor;
+		ImU32 BreakpointClickedColor;
+
+		std::array<ImVec4, TOKEN_TYPE_COUNT> TokenColors; // indexed by disassembler::TokenType
+	};
+
+	constexpr ImVec4 WHITE{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+	/**
+	 * @brief Built-in theme, a theme file only overrides the colours it lists.
+	 */
+	constexpr ColorTheme DEFAULT_COLOR_THEME{
+		WHITE,
+		WHITE,
+		IM_COL32(255, 0, 0, 128),
+		IM_COL32(255, 0, 0, 255),
+		{
+			WHITE,                                 // tUnknown
+			ImVec4(0.847f, 0.623f, 0.862f, 1.0f),  // tKeyword
+			WHITE,                                 // tIdentifier
+			ImVec4(0.635f, 0.752f, 0.545f, 1.0f),  // tNumber
+			ImVec4(0.215f, 0.698f, 0.584f, 1.0f),  // tRegister
+			WHITE,                                 // tLBracket
+			WHITE,                                 // tRBracket
+			WHITE,                                 // tComma
+			WHITE,                                 // tColon
+			WHITE,                                 // tPlus
+			WHITE                                  // tMinus
+		}
+	};
+
+} // namespace UI
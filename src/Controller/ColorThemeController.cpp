@@ -23,11 +23,10 @@ namespace UI
 
 	ColorThemeController::ColorThemeController(std::filesystem::path themeFilePath) : mThemeFilePath(themeFilePath)
 	{
-		if (!std::filesystem::exists(mThemeFilePath)) {
-			throw std::runtime_error("Theme file does not exist: " + mThemeFilePath.string());
+		// the built-in theme is complete, a missing file just leaves it as it is
+		if (std::filesystem::exists(mThemeFilePath)) {
+			LoadColorTheme();
 		}
-
-		LoadColorTheme();
 	}
 
 	void ColorThemeController::SaveColorTheme() const
@@ -39,8 +38,8 @@ namespace UI
 		j["BreakpointHoveredColor"] = mColorTheme.BreakpointHoveredColor;
 		j["BreakpointClickedColor"] = mColorTheme.BreakpointClickedColor;
 
-		for (const auto& [type, color] : mColorTheme.TokenColorsMap) {
-			j["tokenColors"][TokenTypeToString(type)] = ColorToJson(color);
+		for (size_t type = 0; type < mColorTheme.TokenColors.size(); ++type) {
+			j["TokenColors"][TokenTypeToString(static_cast<disassembler::TokenType>(type))] = ColorToJson(mColorTheme.TokenColors[type]);
 		}
 
 		std::ofstream outFile(mThemeFilePath);
@@ -71,14 +70,23 @@ namespace UI
 		json j;
 		file >> j;
 
-		mColorTheme.AddressColor = JsonToColor(j.at("AddressColor"));
-		mColorTheme.BytesColor   = JsonToColor(j.at("BytesColor"));
-		mColorTheme.BreakpointHoveredColor = j.at("BreakpointHoveredColor");
-		mColorTheme.BreakpointClickedColor = j.at("BreakpointClickedColor");
+		// colours the file leaves out keep their current value
+		if (j.contains("AddressColor")) {
+			mColorTheme.AddressColor = JsonToColor(j["AddressColor"]);
+		}
+
+		if (j.contains("BytesColor")) {
+			mColorTheme.BytesColor = JsonToColor(j["BytesColor"]);
+		}
+
+		mColorTheme.BreakpointHoveredColor = j.value("BreakpointHoveredColor", mColorTheme.BreakpointHoveredColor);
+		mColorTheme.BreakpointClickedColor = j.value("BreakpointClickedColor", mColorTheme.BreakpointClickedColor);
 
-		for (const auto& [tokenType, tokenColor] : j["TokenColors"].items()) {
-			const auto type = disassembler::StringToTokenType(tokenType);
-			mColorTheme.TokenColorsMap[type] = JsonToColor(tokenColor);
+		if (j.contains("TokenColors")) {
+			for (const auto& [tokenType, tokenColor] : j["TokenColors"].items()) {
+				const auto type = disassembler::StringToTokenType(tokenType);
+				mColorTheme.TokenColors[type] = JsonToColor(tokenColor);
+			}
 		}
 
 	}
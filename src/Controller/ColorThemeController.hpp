@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include <Model/ColorTheme.hpp>
+#include "ColorTheme.hpp"
 
 #include <filesystem>
 
@@ -16,6 +16,9 @@ namespace UI
 	
 	public:
 
+		/**
+		 * @brief Starts from DEFAULT_COLOR_THEME, overridden by themeFilePath if that file exists.
+		 */
 		ColorThemeController(std::filesystem::path themeFilePath);
 		
 		const ColorTheme& GetColorTheme() const { return mColorTheme; }
@@ -25,7 +28,7 @@ namespace UI
 
 	private:
 
-		ColorTheme mColorTheme;
+		ColorTheme mColorTheme{ DEFAULT_COLOR_THEME };
 		std::filesystem::path mThemeFilePath;
 
 	};
@@ -5,8 +5,10 @@
 #pragma once
 
 #include <Model/Disassembler.hpp>
+#include <Model/InstructionIndex.hpp>
 
 #include <stdexcept>
+#include <vector>
 
 namespace disassembler
 {
@@ -15,7 +17,8 @@ namespace disassembler
 
 	public:
 		
-		DisassemblerController(Disassembler* const disassembler) : mDisassembler(disassembler) 
+		DisassemblerController(Disassembler* const disassembler, const i8086::IMemorySource* memory)
+			: mDisassembler(disassembler), mIndex(memory)
 		{
 			if (!mDisassembler)
 			{
@@ -23,32 +26,98 @@ namespace disassembler
 			}
 		}
 
+		/**
+		 * @brief Snapshots [startAddress, endAddress) and starts indexing it, rows are decoded on demand.
+		 */
 		void Disassembly()
 		{
-			mDisassembler->Disassembly(startAddress, endAddress);
+			mIndex.Build(startAddress, endAddress);
+
+			// visible rows decode from the index copy, which Refresh keeps in sync with memory
+			mDisassembler->SetSource(mIndex.GetCode(), startAddress);
+
+			mVisibleAddresses.clear();
+			mDisassembler->disassembledInstructions.clear();
+		}
+
+		/**
+		 * @brief Re-decodes the pages of the listing written since the last call, meant to run every frame.
+		 */
+		void Refresh()
+		{
+			mIndex.Refresh();
 		}
 
 		const size_t GetDisassembledInstructionsCount() const
 		{
-			return mDisassembler->disassembledInstructions.size();
+			return mIndex.GetRowCount();
+		}
+
+		bool IsIndexComplete() const
+		{
+			return mIndex.IsComplete();
 		}
 
-		DisassembledInstruction& GetDisassembledInstruction(size_t index) const
+		/**
+		 * @brief Decodes and formats rows [firstRow, lastRow), does nothing if they are decoded already.
+		 */
+		void PrepareRows(size_t firstRow, size_t lastRow)
 		{
+			mIndex.GetAddresses(firstRow, lastRow - firstRow, mRowAddresses);
 
-			if (index >= mDisassembler->disassembledInstructions.size())
+			if (firstRow == mVisibleFirstRow && mIndex.GetGeneration() == mVisibleGeneration && mRowAddresses == mVisibleAddresses)
 			{
-				throw std::out_of_range("DisassemblerController::GetInstruction -> Index out of range");
+				++mRowCacheHits;
+				return;
+			}
+
+			++mRowCacheMisses;
+
+			mVisibleFirstRow = firstRow;
+			mVisibleGeneration = mIndex.GetGeneration();
+			mVisibleAddresses.swap(mRowAddresses);
+
+			mDisassembler->DisassemblyAt(mVisibleAddresses);
+		}
+
+		const Instruction& GetDisassembledInstruction(size_t row) const
+		{
+			const size_t index = row - mVisibleFirstRow;
+
+			if (row < mVisibleFirstRow || index >= mDisassembler->disassembledInstructions.size())
+			{
+				throw std::out_of_range("DisassemblerController::GetInstruction -> Row is not prepared");
 			}
 
 			return mDisassembler->disassembledInstructions[index];
 		}
 
+		std::span<const Token> GetTokens(const Instruction& instr) const
+		{
+			return mDisassembler->GetTokenArena().GetTokens(instr.Tokens);
+		}
+
+		std::string_view GetTokenText(const Token& token) const
+		{
+			return mDisassembler->GetTokenArena().GetText(token);
+		}
+
 		u8 GetMaxInstrBytesCount() const
 		{
-			return mDisassembler->GetMaxInstrBytesCount();
+			return mIndex.GetMaxInstrBytesCount();
+		}
+
+		double GetInstructionsPerSecond() const
+		{
+			return mIndex.GetInstructionsPerSecond();
 		}
 
+		/**
+		 * @brief PrepareRows calls that reused the decoded rows, and those that decoded them again.
+		 */
+		u64 GetRowCacheHits() const { return mRowCacheHits; }
+		u64 GetRowCacheMisses() const { return mRowCacheMisses; }
+
 		
 	public:
 		
@@ -57,6 +126,15 @@ namespace disassembler
 
 	private:
 		Disassembler* const mDisassembler{ nullptr };
+
+		InstructionIndex mIndex;
+		size_t mVisibleFirstRow{ 0 };
+		u64 mVisibleGeneration{ 0 };
+		std::vector<u32> mVisibleAddresses;
+		std::vector<u32> mRowAddresses;
+
+		u64 mRowCacheHits{ 0 };
+		u64 mRowCacheMisses{ 0 };
 	};
 
 
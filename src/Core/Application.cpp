@@ -3,11 +3,13 @@
 // Licensed under the MIT License. See LICENSE file for details.
 
 #include "Application.hpp"
+#include "EmbeddedResources.hpp"
 
 #include <backends/imgui_impl_sdl3.h>
 #include <backends/imgui_impl_opengl3.h>
 #include <backends/imgui_impl_opengl3_loader.h>
 
+#include <algorithm>
 #include <filesystem>
 
 constexpr const char* glslVersion = "#version 330";
@@ -16,7 +18,10 @@ constexpr ImVec4 clearColor = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
 Application::Application(const char* title, int width, int height)
 {
     InitSDL(title, width, height);
+    LogStartupPhase("SDL and window");
+
     InitImGui();
+    LogStartupPhase("ImGui");
 }
 
 Application::~Application()
@@ -60,6 +65,8 @@ void Application::InitSDL(const char* title, int width, int height)
 
     SDL_GL_MakeCurrent(mWindow, mGLContext);
     SDL_ShowWindow(mWindow);
+
+    mRedrawEvent = SDL_RegisterEvents(1);
 }
 
 void Application::InitImGui()
@@ -76,12 +83,47 @@ void Application::InitImGui()
 
     style.WindowMenuButtonPosition = ImGuiDir_None;
 
-    ImGui::GetIO().Fonts->AddFontFromFileTTF(std::filesystem::path("Resources/Fonts/FiraCode-SemiBold.ttf").string().c_str(), 16.0f);
+    const std::filesystem::path fontPath = GetResourcePath("Resources/Fonts/FiraCode-SemiBold.ttf");
+
+    if (std::filesystem::exists(fontPath))
+    {
+        io.Fonts->AddFontFromFileTTF(fontPath.string().c_str(), FONT_SIZE);
+    }
+
+    else
+    {
+        // the atlas reads the embedded copy in place
+        ImFontConfig config;
+        config.FontDataOwnedByAtlas = false;
+
+        io.Fonts->AddFontFromMemoryTTF(
+            const_cast<unsigned char*>(EmbeddedResources::FIRA_CODE_SEMIBOLD_TTF),
+            static_cast<int>(EmbeddedResources::FIRA_CODE_SEMIBOLD_TTF_SIZE),
+            FONT_SIZE,
+            &config
+        );
+    }
 
     ImGui_ImplSDL3_InitForOpenGL(mWindow, mGLContext);
     ImGui_ImplOpenGL3_Init(glslVersion);
 }
 
+std::filesystem::path Application::GetResourcePath(const std::filesystem::path& relativePath)
+{
+    const char* basePath = SDL_GetBasePath();
+
+    return basePath ? std::filesystem::path(basePath) / relativePath : relativePath;
+}
+
+void Application::LogStartupPhase(const char* phase)
+{
+    const Uint64 now = SDL_GetTicksNS();
+
+    SDL_Log("Startup: %-16s %8.2f ms (%.2f ms total)", phase, (now - mLastPhaseTicks) * 1e-6, (now - mStartupTicks) * 1e-6);
+
+    mLastPhaseTicks = now;
+}
+
 void Application::Shutdown()
 {
     ImGui_ImplOpenGL3_Shutdown();
@@ -93,12 +135,57 @@ void Application::Shutdown()
     SDL_Quit();
 }
 
+void Application::RequestRedraw()
+{
+    // one request in the queue is enough, the frame it causes shows everything up to then
+    if (mRedrawEvent == 0 || mRedrawPosted.exchange(true))
+    {
+        return;
+    }
+
+    SDL_Event event{};
+    event.type = mRedrawEvent;
+
+    SDL_PushEvent(&event);
+}
+
+void Application::WaitForFrame()
+{
+    if (mPendingFrames > 0 || IsAnimating())
+    {
+        const Uint64 frameTicks = 1000 / MAX_FPS;
+        const Uint64 elapsed = SDL_GetTicks() - mLastFrameTicks;
+
+        if (elapsed < frameTicks)
+        {
+            SDL_Delay(static_cast<Uint32>(frameTicks - elapsed));
+        }
+
+        return;
+    }
+
+    // nothing changes on screen until an event arrives, the timeout keeps things like the text caret alive
+    SDL_WaitEventTimeout(nullptr, IDLE_TIMEOUT_MS);
+    mPendingFrames = 1;
+}
+
 void Application::Run() {
     while (mRunning)
     {
+        WaitForFrame();
+
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
+            if (event.type == mRedrawEvent)
+            {
+                mRedrawPosted = false;
+                mPendingFrames = std::max(mPendingFrames, 1);
+                continue;
+            }
+
+            mPendingFrames = SETTLE_FRAMES;
+
             ImGui_ImplSDL3_ProcessEvent(&event);
 
             if (event.type == SDL_EVENT_QUIT)
@@ -110,32 +197,53 @@ void Application::Run() {
             OnEvent(event);
         }
 
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplSDL3_NewFrame();
-        ImGui::NewFrame();
-        ImGui::DockSpaceOverViewport(0, ImGui::GetMainViewport());
-
-        OnRender();
+        const Uint64 renderStart = SDL_GetTicksNS();
 
-        ImGui::Render();
+        RenderFrame();
 
-        ImGuiIO& io = ImGui::GetIO();
+        mLastRenderSeconds = static_cast<double>(SDL_GetTicksNS() - renderStart) * 1e-9;
+        mLastFrameTicks = SDL_GetTicks();
 
-        glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
-        glClearColor(clearColor.x * clearColor.w, clearColor.y * clearColor.w, clearColor.z * clearColor.w, clearColor.w);
-        glClear(GL_COLOR_BUFFER_BIT);
-        
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        if (!mFirstFrameDone)
+        {
+            mFirstFrameDone = true;
+            LogStartupPhase("first frame");
+        }
 
-        if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+        if (mPendingFrames > 0)
         {
-            SDL_Window* backupCurrentWindow = SDL_GL_GetCurrentWindow();
-            SDL_GLContext backupCurrentContext = SDL_GL_GetCurrentContext();
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
-            SDL_GL_MakeCurrent(backupCurrentWindow, backupCurrentContext);
+            --mPendingFrames;
         }
+    }
+}
+
+void Application::RenderFrame()
+{
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplSDL3_NewFrame();
+    ImGui::NewFrame();
+    ImGui::DockSpaceOverViewport(0, ImGui::GetMainViewport());
+
+    OnRender();
+
+    ImGui::Render();
 
-        SDL_GL_SwapWindow(mWindow);
+    ImGuiIO& io = ImGui::GetIO();
+
+    glViewport(0, 0, (int)io.DisplaySize.x, (int)io.DisplaySize.y);
+    glClearColor(clearColor.x * clearColor.w, clearColor.y * clearColor.w, clearColor.z * clearColor.w, clearColor.w);
+    glClear(GL_COLOR_BUFFER_BIT);
+    
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+    {
+        SDL_Window* backupCurrentWindow = SDL_GL_GetCurrentWindow();
+        SDL_GLContext backupCurrentContext = SDL_GL_GetCurrentContext();
+        ImGui::UpdatePlatformWindows();
+        ImGui::RenderPlatformWindowsDefault();
+        SDL_GL_MakeCurrent(backupCurrentWindow, backupCurrentContext);
     }
+
+    SDL_GL_SwapWindow(mWindow);
 }
\ No newline at end of file
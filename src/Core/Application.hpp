@@ -7,6 +7,20 @@
 #include <SDL3/SDL.h>
 #include <imgui.h>
 
+#include <atomic>
+#include <filesystem>
+
+/**
+ * @brief SDL window with an ImGui frame loop that only draws when there is something new to show.
+ *
+ * @details
+ * While idle the loop sleeps on SDL events. Input, a RequestRedraw from any thread or the
+ * periodic IDLE_TIMEOUT_MS wake-up bring it back for a few frames, enough for ImGui to
+ * settle hover and navigation state. While IsAnimating the frame rate is capped at MAX_FPS.
+ *
+ * Resources are compiled in, files under the executable's directory only override them.
+ * Each startup phase and the first frame are logged with the time they took.
+ */
 class Application {
 
 public:
@@ -19,13 +33,55 @@ protected:
     virtual void OnRender() {}
     virtual void OnEvent(const SDL_Event& event) {}
 
+    /**
+     * @brief True while the content changes without input, frames then keep coming at MAX_FPS.
+     */
+    virtual bool IsAnimating() const { return false; }
+
+    /**
+     * @brief Asks for a frame, safe to call from any thread.
+     */
+    void RequestRedraw();
+
+    /**
+     * @brief Host seconds the previous frame took from NewFrame to swap.
+     */
+    double GetLastRenderTime() const { return mLastRenderSeconds; }
+
+    /**
+     * @brief Path of an optional resource file, relative to the executable's directory rather than the working one.
+     */
+    static std::filesystem::path GetResourcePath(const std::filesystem::path& relativePath);
+
+    /**
+     * @brief Logs the time since the previous phase (or since construction) and since construction.
+     */
+    void LogStartupPhase(const char* phase);
+
 private:
     void InitSDL(const char* title, int width, int height);
     void InitImGui();
     void Shutdown();
+    void WaitForFrame();
+    void RenderFrame();
+
+    static constexpr Uint64 MAX_FPS = 60;
+    static constexpr int SETTLE_FRAMES = 3;
+    static constexpr Sint32 IDLE_TIMEOUT_MS = 500;
+    static constexpr float FONT_SIZE = 16.0f;
 
     SDL_Window* mWindow = nullptr;
     SDL_GLContext mGLContext = nullptr;
     bool mRunning = true;
 
+    Uint32 mRedrawEvent = 0;
+    std::atomic<bool> mRedrawPosted{ false };
+    int mPendingFrames = SETTLE_FRAMES;
+    Uint64 mLastFrameTicks = 0;
+    double mLastRenderSeconds = 0.0;
+
+    Uint64 mStartupTicks = SDL_GetTicksNS();
+    Uint64 mLastPhaseTicks = mStartupTicks;
+    bool mFirstFrameDone = false;
+
 };
\ No newline at end of file
@@ -0,0 +1,18 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Files compiled into the executable, generated by Core/CMakeLists.txt from Resources.
+ */
+namespace EmbeddedResources
+{
+
+	extern const unsigned char FIRA_CODE_SEMIBOLD_TTF[];
+	extern const size_t FIRA_CODE_SEMIBOLD_TTF_SIZE;
+
+} // namespace EmbeddedResources
@@ -6,26 +6,54 @@
 
 #include <portable-file-dialogs.h>
 
+#include <fstream>
+
 EmulatorApp::EmulatorApp()
     : Application("intel 8086", 800, 600),
       mRam(0x200000),
-      mRamController(&mRam),
-      mCpu(&mMemoryBus),
-      mDisassembler(&mMemoryBus),
-      mCpuController(&mCpu),
-      mDisassemblerController(&mDisassembler),
-      mColorThemeController("Resources/DasmColorTheme.json"),
+      mCpu(&mMemoryBus, &mIOBus, &mScheduler),
+      mRamController(&mRam, 0, mTextModeAdapter.GetBaseAddress()),
+      mHighRamController(&mRam, mTextModeAdapter.GetEndAddress() + 1),
+      mDiskController(&mMemoryBus),
+      mIntervalTimer(&mCpu, &mScheduler),
+      mEmulation(&mCpu, &mMemoryBus, &mTextModeAdapter),
+      mDisassembler(mEmulation.GetMemory()),
+      mCpuController(&mCpu, &mEmulation),
+      mDisassemblerController(&mDisassembler, mEmulation.GetMemory()),
+      mColorThemeController(GetResourcePath("Resources/DasmColorTheme.json")),
       mDisassemblerWindow(&mDisassemblerController, &mCpuController, &mColorThemeController),
-      mStateWindow(&mCpuController, &mMemoryBus),
-      mMemoryEditorWindow(&mMemoryBus)
+      mStateWindow(&mCpuController, mEmulation.GetMemory()),
+      mMemoryEditorWindow(&mEmulation),
+      mTextModeWindow(&mTextModeAdapter, &mEmulation),
+      mPerformanceWindow(&mEmulation, &mDisassemblerController),
+      mTraceWindow(&mEmulation),
+      mHeatMapWindow(&mEmulation, &mMemoryEditorWindow, &mDisassemblerWindow)
 {
 
-    mMemoryBus.AttachDevice(&mRamController, 0x00000, 0x1FFFFF);
+    // RAM is split around the video buffer so the adapter sees every write to it
+    mMemoryBus.AttachDevice(&mRamController, 0x00000, mTextModeAdapter.GetBaseAddress() - 1);
+    mMemoryBus.AttachDevice(&mTextModeAdapter, mTextModeAdapter.GetBaseAddress(), mTextModeAdapter.GetEndAddress());
+    mMemoryBus.AttachDevice(&mHighRamController, mTextModeAdapter.GetEndAddress() + 1, 0x1FFFFF);
+
+    mIOBus.AttachDevice(&mIntervalTimer);
+
+    mCpu.AttachIOTracer(&mIOTracer);
+    mCpu.SetInterruptHandler(i8086::DiskController::INT_VECTOR, &mDiskController);
+
+    // a paused machine leaves the UI asleep until something is published
+    mEmulation.SetPublishListener([this]() { RequestRedraw(); });
 
+    // from here on the machine is only touched through mEmulation
+    mEmulation.Start();
+
+    LogStartupPhase("emulator");
 }
 
 void EmulatorApp::OnRender()
 {
+    mEmulation.AcquireSnapshot();
+    mPerformanceWindow.RecordFrame(ImGui::GetIO().DeltaTime, GetLastRenderTime());
+
     if (ImGui::BeginMainMenuBar()) {
 
         if (ImGui::BeginMenu("File")) {
@@ -35,10 +63,33 @@ void EmulatorApp::OnRender()
                 auto filePath = pfd::open_file("Choose a file", ".", {"Executable", "*.com", "*.exe"}).result();
 
                 if (!filePath.empty()) {
-                    mRamController.LoadFile(filePath[0], 0x0);
+                    LoadProgram(filePath[0]);
                 }
             }
 
+            if (ImGui::MenuItem("Mount Floppy Image (A:)")) {
+                MountDiskImage(0x00);
+            }
+
+            if (ImGui::MenuItem("Mount Hard Disk Image (C:)")) {
+                MountDiskImage(0x80);
+            }
+
+            ImGui::Separator();
+
+            if (ImGui::MenuItem("Export I/O Statistics")) {
+                ExportIOStatistics();
+            }
+
+            if (ImGui::MenuItem("Export I/O Trace")) {
+                ExportIOTrace();
+            }
+
+            ImGui::EndMenu();
+        }
+
+        if (ImGui::BeginMenu("Emulation")) {
+            RenderEmulationMenu();
             ImGui::EndMenu();
         }
 
@@ -59,21 +110,224 @@ void EmulatorApp::OnRender()
                 mDisassemblerWindow.ToggleVisibility();
             }
 
+            if (ImGui::MenuItem("Display Window", "", mTextModeWindow.IsOpen()))
+            {
+                mTextModeWindow.ToggleVisibility();
+            }
+
+            if (ImGui::MenuItem("Performance Window", "", mPerformanceWindow.IsOpen()))
+            {
+                mPerformanceWindow.ToggleVisibility();
+            }
+
+            if (ImGui::MenuItem("Trace Window", "", mTraceWindow.IsOpen()))
+            {
+                mTraceWindow.ToggleVisibility();
+            }
+
+            if (ImGui::MenuItem("Heat Map Window", "", mHeatMapWindow.IsOpen()))
+            {
+                mHeatMapWindow.ToggleVisibility();
+            }
+
+            ImGui::Separator();
+
+            if (ImGui::MenuItem("Trace I/O Ports", "", mTraceIO))
+            {
+                mTraceIO = !mTraceIO;
+                mEmulation.Invoke([this, enabled = mTraceIO]() { mIOTracer.SetTraceEnabled(enabled); });
+            }
+
             ImGui::EndMenu();
         }
 
+        RenderEmulationStatus();
+
         ImGui::EndMainMenuBar();
     }
 
     mDisassemblerWindow.ShowIfOpen();
     mStateWindow.ShowIfOpen();
     mMemoryEditorWindow.ShowIfOpen();
+    mTextModeWindow.ShowIfOpen();
+    mPerformanceWindow.ShowIfOpen();
+    mTraceWindow.ShowIfOpen();
+    mHeatMapWindow.ShowIfOpen();
+}
+
+bool EmulatorApp::IsAnimating() const
+{
+    return mEmulation.GetSnapshot().Running;
 }
 
 void EmulatorApp::OnEvent(const SDL_Event& event)
 {
-    if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_C)
+    // keys typed into a text field are not shortcuts
+    if (event.type != SDL_EVENT_KEY_DOWN || ImGui::GetIO().WantTextInput)
     {
-        mCpu.Cycles(1);
+        return;
+    }
+
+    if (event.key.key == SDLK_C)
+    {
+        mEmulation.Step(1);
+    }
+
+    else if (event.key.key == SDLK_F5)
+    {
+        if (mEmulation.GetSnapshot().Running)
+        {
+            mEmulation.Pause();
+        }
+
+        else
+        {
+            mEmulation.Run();
+        }
+    }
+}
+
+void EmulatorApp::RenderEmulationMenu()
+{
+    const i8086::EmulatorSnapshot& snapshot = mEmulation.GetSnapshot();
+
+    if (ImGui::MenuItem("Run", "F5", false, !snapshot.Running)) {
+        mEmulation.Run();
+    }
+
+    if (ImGui::MenuItem("Pause", "F5", false, snapshot.Running)) {
+        mEmulation.Pause();
+    }
+
+    if (ImGui::MenuItem("Step", "C")) {
+        mEmulation.Step(1);
+    }
+
+    if (ImGui::MenuItem("Step N")) {
+        mEmulation.Step(mStepCount);
+    }
+
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::InputScalar("N", ImGuiDataType_U32, &mStepCount);
+
+    ImGui::Separator();
+
+    if (ImGui::BeginMenu("Speed")) {
+
+        struct SpeedOption
+        {
+            const char* Label;
+            u32 Clock;
+        };
+
+        static constexpr SpeedOption speeds[] = {
+            { "4.77 MHz (PC/XT)", i8086::EmulationThread::CLOCK_PC_XT },
+            { "8 MHz",            i8086::EmulationThread::CLOCK_8MHZ },
+            { "2x PC/XT",         i8086::EmulationThread::CLOCK_PC_XT * 2 },
+            { "4x PC/XT",         i8086::EmulationThread::CLOCK_PC_XT * 4 },
+            { "10x PC/XT",        i8086::EmulationThread::CLOCK_PC_XT * 10 },
+            { "Unthrottled",      i8086::EmulationThread::UNTHROTTLED }
+        };
+
+        for (const auto& speed : speeds) {
+
+            if (ImGui::MenuItem(speed.Label, "", snapshot.TargetClock == speed.Clock)) {
+                mEmulation.SetSpeed(speed.Clock);
+            }
+        }
+
+        ImGui::EndMenu();
     }
+}
+
+void EmulatorApp::RenderEmulationStatus() const
+{
+    const i8086::EmulatorSnapshot& snapshot = mEmulation.GetSnapshot();
+
+    ImGui::Separator();
+
+    if (!snapshot.Error.empty()) {
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s: %s", snapshot.Running ? "Error" : "Stopped", snapshot.Error.c_str());
+    }
+
+    else if (snapshot.AtBreakpoint) {
+        ImGui::TextUnformatted("Breakpoint");
+    }
+
+    else if (!snapshot.Running) {
+        ImGui::TextUnformatted("Paused");
+    }
+
+    else if (snapshot.Halted) {
+        ImGui::TextUnformatted("Halted");
+    }
+
+    else {
+        // the reached clock, next to the target when paced
+        if (snapshot.TargetClock == i8086::EmulationThread::UNTHROTTLED) {
+            ImGui::Text("Running %.2f MHz (unthrottled)", snapshot.ClockRate / 1e6);
+        }
+
+        else {
+            ImGui::Text("Running %.2f / %.2f MHz", snapshot.ClockRate / 1e6, snapshot.TargetClock / 1e6);
+        }
+    }
+}
+
+void EmulatorApp::ExportIOStatistics()
+{
+    const auto filePath = pfd::save_file("Export I/O statistics", "io_stats.csv", { "CSV", "*.csv" }).result();
+
+    if (filePath.empty()) {
+        return;
+    }
+
+    // the tracer is written by the emulation thread, it is exported from there
+    mEmulation.Invoke([this, filePath]() {
+        std::ofstream file(filePath);
+        mIOTracer.ExportStatsCSV(file);
+    });
+}
+
+void EmulatorApp::ExportIOTrace()
+{
+    const auto filePath = pfd::save_file("Export I/O trace", "io_trace.csv", { "CSV", "*.csv", "Binary", "*.bin" }).result();
+
+    if (filePath.empty()) {
+        return;
+    }
+
+    mEmulation.Invoke([this, filePath]() {
+
+        if (filePath.ends_with(".bin")) {
+            std::ofstream file(filePath, std::ios::binary);
+            mIOTracer.ExportTraceBinary(file);
+            return;
+        }
+
+        std::ofstream file(filePath);
+        mIOTracer.ExportTraceCSV(file);
+    });
+}
+
+void EmulatorApp::MountDiskImage(u8 drive)
+{
+    const auto filePath = pfd::open_file("Choose a disk image", ".", { "Disk images", "*.img *.ima *.dsk *.vfd", "All files", "*" }).result();
+
+    if (filePath.empty()) {
+        return;
+    }
+
+    // a failed mount comes back as the snapshot error, the machine keeps running
+    mEmulation.Invoke([this, drive, path = filePath[0]]() {
+        mDiskController.Mount(drive, path);
+    });
+}
+
+void EmulatorApp::LoadProgram(const std::string& filePath)
+{
+    mEmulation.Invoke([this, filePath]() {
+        mRamController.LoadFile(filePath, 0x0);
+        mMemoryBus.MarkWritten(0x0, static_cast<u32>(mRamController.GetSize()) - 1);
+    });
 }
\ No newline at end of file
@@ -11,13 +11,23 @@
 #include <Model/Disassembler.hpp>
 #include <Model/MemoryBus.hpp>
 #include <Model/IOBus.hpp>
-#include <Controller/RAMController.hpp>
+#include <Model/IOTracer.hpp>
+#include <Model/TextModeAdapter.hpp>
+#include <Model/Scheduler.hpp>
+#include <Model/DiskController.hpp>
+#include <Model/IntervalTimer.hpp>
+#include <Model/EmulationThread.hpp>
+#include <Model/RAMController.hpp>
 #include <Controller/CPUController.hpp>
 #include <Controller/DisassemblerController.hpp>
 #include <Controller/ColorThemeController.hpp>
 #include <View/DisassemblerWindow.hpp>
+#include <View/HeatMapWindow.hpp>
 #include <View/StateWindow.hpp>
 #include <View/MemoryEditorWindow.hpp>
+#include <View/PerformanceWindow.hpp>
+#include <View/TextModeWindow.hpp>
+#include <View/TraceWindow.hpp>
 
 class EmulatorApp : public Application {
 
@@ -27,19 +37,38 @@ public:
 protected:
     void OnRender() override;
     void OnEvent(const SDL_Event& event) override;
+    bool IsAnimating() const override;
+
+private:
+
+    void ExportIOStatistics();
+    void ExportIOTrace();
+    void MountDiskImage(u8 drive);
+    void LoadProgram(const std::string& filePath);
+    void RenderEmulationMenu();
+    void RenderEmulationStatus() const;
 
 private:
 
     // Models
     i8086::RAM mRam;
+    i8086::Scheduler mScheduler;
     i8086::I8086 mCpu;
     i8086::MemoryBus mMemoryBus;
     i8086::IO::IOBus mIOBus;
+    i8086::IO::IOTracer mIOTracer;
+    i8086::TextModeAdapter mTextModeAdapter;
+    i8086::RAMController mRamController;
+    i8086::RAMController mHighRamController;
+    i8086::DiskController mDiskController;
+    i8086::IntervalTimer mIntervalTimer;
+
+    // owns the models above once started, declared after them so it stops first
+    i8086::EmulationThread mEmulation;
     disassembler::Disassembler mDisassembler;
 
     // Controllers
     i8086::CPUController mCpuController;
-    i8086::RAMController mRamController;
     disassembler::DisassemblerController mDisassemblerController;
     UI::ColorThemeController mColorThemeController;
 
@@ -47,4 +76,11 @@ private:
     UI::MemoryEditorWindow mMemoryEditorWindow;
     UI::DisassemblerWindow mDisassemblerWindow;
     UI::StateWindow mStateWindow;
+    UI::TextModeWindow mTextModeWindow;
+    UI::PerformanceWindow mPerformanceWindow;
+    UI::TraceWindow mTraceWindow;
+    UI::HeatMapWindow mHeatMapWindow;
+
+    bool mTraceIO{ false }; // UI copy of the tracer switch, the tracer itself runs on the emulation thread
+    u32 mStepCount{ 1000 };
 };
\ No newline at end of file
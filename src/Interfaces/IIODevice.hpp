@@ -27,6 +27,9 @@ namespace i8086::IO
 		u16 GetEndPort() const { return mEndPort; }
 
 	protected:
+		IIODevice() = default;
+		IIODevice(u16 startPort, u16 endPort) : mStartPort(startPort), mEndPort(endPort) {}
+
 		const u16 mStartPort{};
 		const u16 mEndPort{};
 	};
@@ -0,0 +1,30 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Model/CPUState.hpp>
+#include <Utils/types.hpp>
+
+namespace i8086
+{
+
+    /**
+     * @brief Host-side service for a software interrupt (BIOS/DOS call emulation).
+     */
+    class IInterruptHandler
+    {
+
+    public:
+
+        virtual ~IInterruptHandler() = default;
+
+        /**
+         * @return true if the call was serviced, false to dispatch it through the IVT as usual.
+         */
+        virtual bool HandleInterrupt(u8 vector, CPUState& state) = 0;
+
+    };
+
+} // namespace i8086
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <Utils/types.hpp>
+
 #include <cstddef>
+#include <span>
 
 namespace i8086
 {
@@ -19,6 +21,32 @@ namespace i8086
         virtual u16 Read(u32 address, u8 size) const = 0;
         virtual size_t GetSize() const = 0;
 
+        /**
+         * @brief Copies a contiguous range of the device into a buffer.
+         *
+         * @details
+         * The default implementation falls back to byte reads, devices backed by
+         * plain memory should override it with a single copy.
+         */
+        virtual void ReadBlock(u32 address, std::span<u8> buffer) const
+        {
+            for (size_t i = 0; i < buffer.size(); ++i)
+            {
+                buffer[i] = static_cast<u8>(Read(address + static_cast<u32>(i), 8));
+            }
+        }
+
+        /**
+         * @brief Copies a buffer into a contiguous range of the device.
+         */
+        virtual void WriteBlock(u32 address, std::span<const u8> data)
+        {
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                Write(address + static_cast<u32>(i), data[i], 8);
+            }
+        }
+
     };
 
 } // namespace i8086
\ No newline at end of file
@@ -0,0 +1,41 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <cstddef>
+#include <span>
+
+namespace i8086
+{
+
+    /**
+     * @brief Read-only view of the physical address space.
+     *
+     * @details
+     * Implemented by the live MemoryBus and by the copies of it published to the UI, so
+     * debugger views and caches (disassembly listings) work on either.
+     */
+    class IMemorySource
+    {
+
+    public:
+
+        static constexpr u32 PAGE_BITS = 12;
+
+        virtual ~IMemorySource() = default;
+
+        virtual void ReadBlock(u32 physicalAddress, std::span<u8> buffer) const = 0;
+        virtual size_t GetSize() const = 0;
+
+        /**
+         * @brief Write counter of a 4 KiB page (physicalAddress >> PAGE_BITS), bumped by every write that touches it.
+         */
+        virtual u32 GetPageVersion(u32 page) const = 0;
+
+    };
+
+} // namespace i8086
@@ -0,0 +1,72 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "AccessRecorder.hpp"
+
+#include <algorithm>
+
+namespace i8086
+{
+
+	void AccessRecorder::Reset(size_t memorySize)
+	{
+		mLines.assign((memorySize + LINE_SIZE - 1) >> LINE_BITS, 0);
+		mTouched.clear();
+	}
+
+	void AccessRecorder::AppendLine(std::vector<AccessRange>& ranges, u32 line)
+	{
+		const u32 first = line << LINE_BITS;
+
+		// lines come in order, a line right after the last range extends it
+		if (!ranges.empty() && ranges.back().Last + 1 == first)
+		{
+			ranges.back().Last = first + LINE_SIZE - 1;
+			return;
+		}
+
+		ranges.push_back({ first, first + LINE_SIZE - 1 });
+	}
+
+	void AccessRecorder::Collect(std::vector<AccessRange>& outReads, std::vector<AccessRange>& outWrites, bool previousTaken)
+	{
+		outReads.clear();
+		outWrites.clear();
+
+		std::sort(mTouched.begin(), mTouched.end());
+
+		size_t kept = 0;
+
+		for (const u32 line : mTouched)
+		{
+			u8& flags = mLines[line];
+
+			if (previousTaken)
+			{
+				flags &= FRESH_READ | FRESH_WRITE;
+			}
+
+			if (flags & (FRESH_READ | CARRIED_READ))
+			{
+				AppendLine(outReads, line);
+			}
+
+			if (flags & (FRESH_WRITE | CARRIED_WRITE))
+			{
+				AppendLine(outWrites, line);
+			}
+
+			// all of it is carried until a snapshot holding it is taken
+			flags = static_cast<u8>(((flags | (flags >> 2)) & (FRESH_READ | FRESH_WRITE)) << 2);
+
+			if (flags != 0)
+			{
+				mTouched[kept++] = line;
+			}
+		}
+
+		mTouched.resize(kept);
+	}
+
+} // namespace i8086
@@ -0,0 +1,90 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Interfaces/IMemoryObserver.hpp>
+#include <Utils/types.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace i8086
+{
+
+	/**
+	 * @brief Inclusive range of physical addresses.
+	 */
+	struct AccessRange
+	{
+		u32 First{};
+		u32 Last{};
+	};
+
+	/**
+	 * @brief Collects which memory the CPU reads and writes between two snapshots, in lines of LINE_SIZE bytes.
+	 *
+	 * @details
+	 * Registered as a bus observer on the emulation thread. An access sets a flag in a per-line
+	 * table and remembers the line the first time it is touched, the ranges are only built once
+	 * per publish by Collect.
+	 *
+	 * Lines of a snapshot the UI never took are carried into the next one, until a snapshot
+	 * holding them is taken.
+	 */
+	class AccessRecorder : public IMemoryObserver
+	{
+
+	public:
+
+		static constexpr u32 LINE_BITS = 4;
+		static constexpr u32 LINE_SIZE = 1u << LINE_BITS;
+
+		void Reset(size_t memorySize);
+
+		void OnRead(u32 address) override { Mark(address, FRESH_READ); }
+		void OnWrite(u32 address, u16 /*data*/) override { Mark(address, FRESH_WRITE); }
+
+		/**
+		 * @brief Merges the lines touched since the last snapshot the UI took into sorted ranges.
+		 *
+		 * @param previousTaken Whether the UI took the snapshot of the previous Collect, whose lines are then dropped.
+		 */
+		void Collect(std::vector<AccessRange>& outReads, std::vector<AccessRange>& outWrites, bool previousTaken);
+
+	private:
+
+		static constexpr u8 FRESH_READ    = 0x01;
+		static constexpr u8 FRESH_WRITE   = 0x02;
+		static constexpr u8 CARRIED_READ  = 0x04;
+		static constexpr u8 CARRIED_WRITE = 0x08;
+
+		void Mark(u32 address, u8 flag)
+		{
+			const u32 line = address >> LINE_BITS;
+
+			if (line >= mLines.size())
+			{
+				return;
+			}
+
+			u8& flags = mLines[line];
+
+			if (flags == 0)
+			{
+				mTouched.push_back(line);
+			}
+
+			flags |= flag;
+		}
+
+		static void AppendLine(std::vector<AccessRange>& ranges, u32 line);
+
+	private:
+
+		std::vector<u8> mLines;    // FRESH_* and CARRIED_* flags per line
+		std::vector<u32> mTouched; // lines with any flag set
+	};
+
+} // namespace i8086
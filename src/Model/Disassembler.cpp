@@ -4,14 +4,18 @@
 
 #include "Disassembler.hpp"
 
-#include <format>
-#include <array>
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
 
 namespace disassembler
 {
 
-	constexpr std::array<const char*, 120> Keywords =
+	constexpr std::array<std::string_view, 120> Keywords =
 	{
 		 "ADD",    "ADC",   "SUB",   "SBB",   "MUL",  "IMUL",   "DIV",
 		"IDIV",     "OR",   "AND",   "XOR",   "ROL",   "ROR",   "RCL",
@@ -33,7 +37,7 @@ namespace disassembler
 		 "PTR"
 	};
 
-	constexpr std::array<const char*, 20> Registers =
+	constexpr std::array<std::string_view, 20> Registers =
 	{
 		"AX", "AH", "AL",
 		"BX", "BH", "BL",
@@ -43,455 +47,747 @@ namespace disassembler
 		"CS", "DS", "SS", "ES"
 	};
 
-	constexpr std::array<const Instr, 256> InstrTable = 
-	{{
-			{  "ADD {}, {}",     rm8,   r8,  true}, {  "ADD {}, {}",    rm16,  r16,  true}, {  "ADD {}, {}",      r8,     rm8,  true}, {  "ADD {}, {}",     r16,    rm16,  true}, {"ADD AL, {}{}", implied,   i8, false}, {"ADD AX, {}{}", implied,  i16, false}, {     "PUSH ES", implied,    none, false}, {      "POP ES", implied,    none, false}, {    "OR {}, {}",     rm8,   r8,  true}, {    "OR {}, {}",    rm16,  r16,  true}, {   "OR {}, {}",      r8,  rm8,  true}, {   "OR {}, {}",     r16, rm16,  true}, { "OR AL, {}{}", implied,      i8, false}, { "OR AX, {}{}", implied,     i16, false}, {     "PUSH CS", implied,    none, false}, {      "POP CS", implied,    none, false},
-			{  "ADC {}, {}",     rm8,   r8,  true}, {  "ADC {}, {}",    rm16,  r16,  true}, {  "ADC {}, {}",      r8,     rm8,  true}, {  "ADC {}, {}",     r16,    rm16,  true}, {"ADC AL, {}{}", implied,   i8, false}, {"ADC AX, {}{}", implied,  i16, false}, {     "PUSH SS", implied,    none, false}, {      "POP SS", implied,    none, false}, {   "SBB {}, {}",     rm8,   r8,  true}, {   "SBB {}, {}",    rm16,  r16,  true}, {  "SBB {}, {}",      r8,  rm8,  true}, {  "SBB {}, {}",     r16, rm16,  true}, {"SBB AL, {}{}", implied,      i8, false}, {"SBB AX, {}{}", implied,     i16, false}, {     "PUSH DS", implied,    none, false}, {      "POP DS", implied,    none, false},
-			{  "AND {}, {}",     rm8,   r8,  true}, {  "AND {}, {}",    rm16,  r16,  true}, {  "AND {}, {}",      r8,     rm8,  true}, {  "AND {}, {}",     r16,    rm16,  true}, {"AND AL, {}{}", implied,   i8, false}, {"AND AX, {}{}", implied,  i16, false}, {         "ES:",    none,    none, false}, {         "DAA",    none,    none, false}, {   "SUB {}, {}",     rm8,   r8,  true}, {   "SUB {}, {}",    rm16,  r16,  true}, {  "SUB {}, {}",      r8,  rm8,  true}, {  "SUB {}, {}",     r16, rm16,  true}, {"SUB AL, {}{}", implied,      i8, false}, {"SUB AX, {}{}", implied,     i16, false}, {         "CS:",    none,    none, false}, {         "DAS",    none,    none, false},
-			{  "XOR {}, {}",     rm8,   r8,  true}, {  "XOR {}, {}",    rm16,  r16,  true}, {  "XOR {}, {}",      r8,     rm8,  true}, {  "XOR {}, {}",     r16,    rm16,  true}, {"XOR AL, {}{}", implied,   i8, false}, {"XOR AX, {}{}", implied,  i16, false}, {         "SS:",    none,    none, false}, {         "AAA",    none,    none, false}, {   "CMP {}, {}",     rm8,   r8,  true}, {   "CMP {}, {}",    rm16,  r16,  true}, {  "CMP {}, {}",      r8,  rm8,  true}, {  "CMP {}, {}",     r16, rm16,  true}, {"CMP AL, {}{}", implied,      i8, false}, {"CMP AX, {}{}", implied,     i16, false}, {         "DS:",    none,    none, false}, {         "AAS",    none,    none, false},
-			{      "INC AX", implied, none, false}, {      "INC CX", implied, none, false}, {      "INC DX", implied,    none, false}, {      "INC BX", implied,    none, false}, {      "INC SP", implied, none, false}, {      "INC BP", implied, none, false}, {      "INC SI", implied,    none, false}, {      "INC DI", implied,    none, false}, {       "DEC AX", implied, none, false}, {       "DEC CX", implied, none, false}, {      "DEC DX", implied, none, false}, {      "DEC BX", implied, none, false}, {      "DEC SP", implied,    none, false}, {      "DEC BP", implied,    none, false}, {      "DEC SI", implied,    none, false}, {      "DEC DI", implied,    none, false},
-			{     "PUSH AX", implied, none, false}, {     "PUSH CX", implied, none, false}, {     "PUSH DX", implied,    none, false}, {     "PUSH BX", implied,    none, false}, {     "PUSH SP", implied, none, false}, {     "PUSH BP", implied, none, false}, {     "PUSH SI", implied,    none, false}, {     "PUSH DI", implied,    none, false}, {       "POP AX", implied, none, false}, {       "POP CX", implied, none, false}, {      "POP DX", implied, none, false}, {      "POP BX", implied, none, false}, {      "POP SP", implied,    none, false}, {      "POP BP", implied,    none, false}, {      "POP SI", implied,    none, false}, {      "POP DI", implied,    none, false},
-			{         "NOP",    none, none, false}, {         "NOP",    none, none, false}, {         "NOP",    none,    none, false}, {         "NOP",    none,    none, false}, {         "NOP",    none, none, false}, {         "NOP",    none, none, false}, {         "NOP",    none,    none, false}, {         "NOP",    none,    none, false}, {          "NOP",    none, none, false}, {          "NOP",    none, none, false}, {         "NOP",    none, none, false}, {         "NOP",    none, none, false}, {         "NOP",    none,    none, false}, {         "NOP",    none,    none, false}, {         "NOP",    none,    none, false}, {         "NOP",    none,    none, false},
-			{     "JO {}{}",    rel8, none, false}, {    "JNO {}{}",    rel8, none, false}, {     "JC {}{}",    rel8,    none, false}, {    "JNC {}{}",    rel8,    none, false}, {     "JZ {}{}",    rel8, none, false}, {    "JNZ {}{}",    rel8, none, false}, {    "JNA {}{}",    rel8,    none, false}, {     "JA {}{}",    rel8,    none, false}, {      "JS {}{}",    rel8, none, false}, {     "JNS {}{}",    rel8, none, false}, {     "JP {}{}",    rel8, none, false}, {    "JNP {}{}",    rel8, none, false}, {     "JL {}{}",    rel8,    none, false}, {    "JNL {}{}",    rel8,    none, false}, {    "JLE {}{}",    rel8,    none, false}, {     "JG {}{}",    rel8,    none, false},
-			{         "GRP",    none, none,  true}, {         "GRP",    none, none,  true}, {         "GRP",    none,    none,  true}, {         "GRP",    none,    none,  true}, { "TEST {}, {}",     rm8,   r8,  true}, { "TEST {}, {}",    rm16,  r16,  true}, { "XCHG {}, {}",      r8,     rm8,  true}, { "XCHG {}, {}",     r16,    rm16,  true}, {   "MOV {}, {}",     rm8,   r8,  true}, {   "MOV {}, {}",    rm16,  r16,  true}, {   "MOV {}, {}",     r8,  rm8,  true}, {   "MOV {}, {}",    r16, rm16,  true}, {         "GRP",    none,    none,  true}, {  "LEA {}, {}",     r16,    rm16,  true}, {         "GRP",    none,    none,  true}, {         "GRP",    none,    none,  true},
-			{         "NOP",    none, none, false}, {     "XCHG CX", implied, none, false}, {     "XCHG DX", implied,    none, false}, {     "XCHG BX", implied,    none, false}, {     "XCHG SP", implied, none, false}, {     "XCHG BP", implied, none, false}, {     "XCHG SI", implied,    none, false}, {     "XCHG DI", implied,    none, false}, {          "CBW",    none, none, false}, {          "CWD",    none, none, false}, {   "CALL {}{}", segAddr, none, false}, {        "WAIT",    none, none, false}, {       "PUSHF",    none,    none, false}, {        "POPF",    none,    none, false}, {        "SAHF",    none,    none, false}, {        "LAHF",    none,    none, false},
-			{"MOV AL, {}{}", implied, addr, false}, {"MOV AX, {}{}", implied, addr, false}, {"MOV {}{}, AL",    addr, implied, false}, {"MOV {}{}, AX",    addr, implied, false}, {       "MOVSB",    none, none, false}, {       "MOVSW",    none, none, false}, {       "CMPSB",    none,    none, false}, {       "CMPSW",    none,    none, false}, {"TEST AL, {}{}", implied,   i8, false}, {"TEST AX, {}{}", implied,  i16, false}, {       "STOSB",    none, none, false}, {       "STOSW",    none, none, false}, {       "LODSB",    none,    none, false}, {       "LODSW",    none,    none, false}, {       "SCASB",    none,    none, false}, {       "SCASW",    none,    none, false},
-			{"MOV AL, {}{}", implied,   i8, false}, {"MOV CL, {}{}", implied,   i8, false}, {"MOV DL, {}{}", implied,      i8, false}, {"MOV BL, {}{}", implied,      i8, false}, {"MOV AH, {}{}", implied,   i8, false}, {"MOV CH, {}{}", implied,   i8, false}, {"MOV DH, {}{}", implied,      i8, false}, {"MOV BH, {}{}", implied,      i8, false}, { "MOV AX, {}{}", implied,  i16, false}, { "MOV CX, {}{}", implied,  i16, false}, {"MOV DX, {}{}", implied,  i16, false}, {"MOV BX, {}{}", implied,  i16, false}, {"MOV SP, {}{}", implied,     i16, false}, {"MOV BP, {}{}", implied,     i16, false}, {"MOV SI, {}{}", implied,     i16, false}, {"MOV DI, {}{}", implied,     i16, false},
-			{         "NOP",    none, none, false}, {         "NOP",    none, none, false}, {    "RET {}{}",     i16,    none, false}, {         "RET",    none,    none, false}, {  "LES {}, {}",     r16, rm16,  true}, {  "LDS {}, {}",     r16, rm16,  true}, {         "GRP",    none,    none,  true}, {         "GRP",    none,    none,  true}, {          "NOP",    none, none, false}, {          "NOP",    none, none, false}, {   "RETF {}{}",     i16, none, false}, {        "RETF",    none, none, false}, {       "INT 3", implied,    none, false}, {    "INT {}{}",      i8,    none, false}, {        "INTO",    none,    none, false}, {        "IRET",    none,    none, false},
-			{         "GRP",    none, none,  true}, {         "GRP",    none, none,  true}, {         "GRP",    none,    none,  true}, {         "GRP",    none,    none,  true}, {         "AAM",    none, none, false}, {         "AAD",    none, none, false}, {         "NOP",    none,    none, false}, {        "XLAT",    none,    none, false}, {          "ESC",    none, none, false}, {          "ESC",    none, none, false}, {         "ESC",    none, none, false}, {         "ESC",    none, none, false}, {         "ESC",    none,    none, false}, {         "ESC",    none,    none, false}, {         "ESC",    none,    none, false}, {         "ESC",    none,    none, false},
-			{ "LOOPNZ {}{}",    rel8, none, false}, {  "LOOPZ {}{}",    rel8, none, false}, {   "LOOP {}{}",    rel8,    none, false}, {   "JCXZ {}{}",    rel8, implied, false}, { "IN AL, {}{}", implied,   i8, false}, { "IN AX, {}{}", implied,   i8, false}, {  "OUT {}, AL",      i8, implied, false}, {  "OUT {}, AX",      i8, implied, false}, {      "CALL {}",    addr, none, false}, {       "JMP {}",    addr, none, false}, {    "JMP {}{}", segAddr, none, false}, {    "JMP {}{}",    rel8, none, false}, {   "IN AL, DX", implied, implied, false}, {   "IN AX, DX", implied, implied, false}, {  "OUT DX, AL", implied, implied, false}, {  "OUT DX, AX", implied, implied, false},
-			{        "LOCK",    none, none, false}, {         "NOP",    none, none, false}, {       "REPNZ",    none,    none, false}, {         "REP",    none,    none, false}, {         "HLT",    none, none, false}, {         "CMC",    none, none, false}, {         "GRP",    none,    none,  true}, {         "GRP",    none,    none,  true}, {          "CLC",    none, none, false}, {          "STC",    none, none, false}, {         "CLI",    none, none, false}, {         "STI",    none, none, false}, {         "CLD",    none,    none, false}, {         "STD",    none,    none, false}, {         "GRP",    none,    none,  true}, {         "GRP",    none,    none,  true}
+	constexpr std::array<const std::array<const char*, 2>, 8> RmBaseRegisters = {{
+		{ "BX", "SI" }, { "BX", "DI" }, { "BP", "SI" }, { "BP", "DI" },
+		{ "SI", nullptr }, { "DI", nullptr }, { "BP", nullptr }, { "BX", nullptr }
 	}};
 
-	constexpr std::array<const Instr, 136> GroupinstrTable =
-	{{
-		{  "ADD {}, {}",     rm8,      i8}, {   "OR {}, {}",     rm8,      i8}, {  "ADC {}, {}",     rm8,      i8}, {  "SBB {}, {}",     rm8,      i8}, {"AND {}, {}",  rm8,      i8}, {"SUB {}, {}",     rm8,      i8}, {"XOR {}, {}",  rm8,   i8}, {"CMP {}, {}",  rm8,      i8},
-		{  "ADD {}, {}",    rm16,     i16}, {   "OR {}, {}",    rm16,     i16}, {  "ADC {}, {}",    rm16,     i16}, {  "SBB {}, {}",    rm16,     i16}, {"AND {}, {}", rm16,     i16}, {"SUB {}, {}",    rm16,     i16}, {"XOR {}, {}", rm16,  i16}, {"CMP {}, {}", rm16,     i16},
-		{  "ADD {}, {}",     rm8,      i8}, {   "OR {}, {}",     rm8,      i8}, {  "ADC {}, {}",     rm8,      i8}, {  "SBB {}, {}",     rm8,      i8}, {"AND {}, {}",  rm8,      i8}, {"SUB {}, {}",     rm8,      i8}, {"XOR {}, {}",  rm8,   i8}, {"CMP {}, {}",  rm8,      i8},
-		{  "ADD {}, {}",    rm16,     se8}, {   "OR {}, {}",    rm16,     se8}, {  "ADC {}, {}",    rm16,     se8}, {  "SBB {}, {}",    rm16,     se8}, {"AND {}, {}", rm16,     se8}, {"SUB {}, {}",    rm16,     se8}, {"XOR {}, {}", rm16,  se8}, {"CMP {}, {}", rm16,     se8},
-		{  "MOV {}, ES",    rm16, implied}, {  "MOV {}, CS",    rm16, implied}, {  "MOV {}, SS",    rm16, implied}, {  "MOV {}, DS",    rm16, implied}, {       "NOP", none,    none}, {       "NOP",    none,    none}, {       "NOP", none, none}, {       "NOP", none,    none},
-		{"MOV ES, {}{}", implied,    rm16}, {"MOV CS, {}{}", implied,    rm16}, {"MOV SS, {}{}", implied,    rm16}, {"MOV DS, {}{}", implied,    rm16}, {       "NOP", none,    none}, {       "NOP",    none,    none}, {       "NOP", none, none}, {       "NOP", none,    none},
-		{      "POP {}",    rm16,    none}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {       "NOP", none,    none}, {       "NOP",    none,    none}, {       "NOP", none, none}, {       "NOP", none,    none},
-		{  "MOV {}, {}",     rm8,      i8}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {       "NOP", none,    none}, {       "NOP",    none,    none}, {       "NOP", none, none}, {       "NOP", none,    none},
-		{  "MOV {}, {}",    rm16,     i16}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {       "NOP", none,    none}, {       "NOP",    none,    none}, {       "NOP", none, none}, {       "NOP", none,    none},
-		{   "ROL {}, 1",     rm8, implied}, {   "ROR {}, 1",     rm8, implied}, {   "RCL {}, 1",     rm8, implied}, {   "RCR {}, 1",     rm8, implied}, { "SHL {}, 1",  rm8, implied}, { "SHR {}, 1",     rm8, implied}, {       "NOP", none, none}, { "SAR {}, 1",  rm8, implied},
-		{   "ROL {}, 1",    rm16, implied}, {   "ROR {}, 1",    rm16, implied}, {   "RCL {}, 1",    rm16, implied}, {   "RCR {}, 1",    rm16, implied}, { "SHL {}, 1", rm16, implied}, { "SHR {}, 1",    rm16, implied}, {       "NOP", none, none}, { "SAR {}, 1", rm16, implied},
-		{  "ROL {}, CL",     rm8, implied}, {  "ROR {}, CL",     rm8, implied}, {  "RCL {}, CL",     rm8, implied}, {  "RCR {}, CL",     rm8, implied}, {"SHL {}, CL",  rm8, implied}, {"SHR {}, CL",     rm8, implied}, {       "NOP", none, none}, {"SAR {}, CL",  rm8, implied},
-		{  "ROL {}, CL",    rm16, implied}, {  "ROR {}, CL",    rm16, implied}, {  "RCL {}, CL",    rm16, implied}, {  "RCR {}, CL",    rm16, implied}, {"SHL {}, CL", rm16, implied}, {"SHR {}, CL",    rm16, implied}, {       "NOP", none, none}, {"SAR {}, CL", rm16, implied},
-		{ "TEST {}, {}",     rm8,      i8}, {         "NOP",    none,    none}, {      "NOT {}",     rm8,    none}, {      "NEG {}",     rm8,    none}, {    "MUL {}",  rm8,    none}, {   "IMUL {}",     rm8,    none}, {    "DIV {}",  rm8, none}, {   "IDIV {}",  rm8,    none},
-		{ "TEST {}, {}",    rm16,     i16}, {         "NOP",    none,    none}, {      "NOT {}",    rm16,    none}, {      "NEG {}",    rm16,    none}, {    "MUL {}", rm16,    none}, {   "IMUL {}",    rm16,    none}, {    "DIV {}", rm16, none}, {   "IDIV {}", rm16,    none},
-		{      "INC {}",     rm8,    none}, {      "DEC {}",     rm8,    none}, {         "NOP",    none,    none}, {         "NOP",    none,    none}, {       "NOP", none,    none}, {       "NOP",    none,    none}, {       "NOP", none, none}, {       "NOP", none,    none},
-		{      "INC {}",    rm16,    none}, {      "DEC {}",    rm16,    none}, {     "CALL {}",    rm16,    none}, {     "CALL {}", segAddr,    none}, {    "JMP {}", rm16,    none}, {    "JMP {}", segAddr,    none}, {   "PUSH {}", addr, none}, {       "NOP", none,    none}
-	}};
-
-	constexpr std::array<const std::array<const char*, 8>, 5> ModrmLookUpTable = {{
-		{           "[BX + SI]",            "[BX + DI]",            "[BP + SI]",            "[BP + DI]",            "[SI]",            "[DI]",      "[0x{:04X}]", "[BX]"},
-		{       "[BX + SI{:+}]",        "[BX + DI{:+}]",        "[BP + SI{:+}]",        "[BP + DI{:+}]",        "[SI{:+}]",        "[DI{:+}]",        "[BP{:+}]", "[BX{:+}]"},
-		{"[BX + SI + 0x{:04X}]", "[BX + DI + 0x{:04X}]", "[BP + SI + 0x{:04X}]", "[BP + DI + 0x{:04X}]", "[SI + 0x{:04X}]", "[DI + 0x{:04X}]", "[BP + 0x{:04X}]", "[BX + 0x{:04X}]"},
-		{"AL", "CL", "DL", "BL", "AH", "CH", "DH", "BH"},
-		{"AX", "CX", "DX", "BX", "SP", "BP", "SI", "DI"}
-	}};
+	constexpr std::array<const char*, 8> Registers8  = { "AL", "CL", "DL", "BL", "AH", "CH", "DH", "BH" };
+	constexpr std::array<const char*, 8> Registers16 = { "AX", "CX", "DX", "BX", "SP", "BP", "SI", "DI" };
 
-	Disassembler::Disassembler(const i8086::MemoryBus* bus) : mBus(bus)
-	{
-		mOperandGetters.insert({
-			{    none, &Disassembler::GetNoneOperand },
-			{ implied, &Disassembler::GetImpliedOperand },
-			{    rel8, &Disassembler::GetRelativeOperand },
-			{     se8, &Disassembler::GetSignExtendedOperand },
-			{      i8, &Disassembler::GetI8Operand },
-			{     i16, &Disassembler::GetI16Operand },
-			{     rm8, &Disassembler::GetRm8Operand },
-			{    rm16, &Disassembler::GetRm16Operand },
-			{      r8, &Disassembler::GetR8Operand },
-			{     r16, &Disassembler::GetR16Operand },
-			{    addr, &Disassembler::GetAddressOperand },
-			{ segAddr, &Disassembler::GetRegisterOverrideOperand }
-		});
+	static inline const i8086::OpcodeInfo& GetInstr(u16 id)
+	{
+		return (id >= Disassembler::GROUP_ID_BASE) ? i8086::GroupTable[id - Disassembler::GROUP_ID_BASE] : i8086::OpcodeTable[id];
 	}
 
-	void Disassembler::Disassembly(u32 StartAddress, u32 EndAddress)
+	struct Word
 	{
-		IP = StartAddress;
-		mMaxInstrBytesCount = 0;
-		
-		disassembledInstructions = std::vector<DisassembledInstruction>();
+		std::string_view Text;
+		TokenType Type{ tUnknown };
+	};
 
-		while (IP < EndAddress)
+	constexpr auto MakeWords()
+	{
+		std::array<Word, Keywords.size() + Registers.size()> words{};
+
+		for (size_t i = 0; i < Keywords.size(); ++i)
 		{
-			mTempInstruction.Address = IP;
+			words[i] = { Keywords[i], tKeyword };
+		}
 
-			Decode(Fetch());
+		for (size_t i = 0; i < Registers.size(); ++i)
+		{
+			words[Keywords.size() + i] = { Registers[i], tRegister };
+		}
 
-			disassembledInstructions.push_back(mTempInstruction);
-			
-			if (mTempInstruction.Bytes.size() > mMaxInstrBytesCount)
-			{
-				mMaxInstrBytesCount = static_cast<u8>(mTempInstruction.Bytes.size());
-			}
+		return words;
+	}
+
+	constexpr auto Words = MakeWords();
 
-			mTempInstruction.Clear();
+	/**
+	 * @brief Collision-free hash of the known words, searched for at compile time.
+	 *
+	 * @details
+	 * FNV-1a from a seed, the slot is taken from the high bits, which depend on every
+	 * character. Seeds are tried until each word lands in a slot of its own, so a lookup
+	 * is one hash and one comparison.
+	 */
+	constexpr u32 WORD_HASH_BITS = 11;
+
+	constexpr u32 HashWord(std::string_view word, u32 seed)
+	{
+		u32 hash = seed;
+
+		for (const char c : word)
+		{
+			hash = (hash ^ static_cast<u8>(c)) * 16777619u;
 		}
 
+		return hash >> (32 - WORD_HASH_BITS);
 	}
 
-	static inline bool IsKeyword(const std::string& str)
+	struct WordTable
 	{
-		for (const auto& keyword : Keywords)
+		u32 Seed{};
+		std::array<u8, 1u << WORD_HASH_BITS> Slots{}; // 1 + index in Words, 0 if empty
+	};
+
+	constexpr WordTable MakeWordTable()
+	{
+		static_assert(Words.size() < 0xFF, "Word indices must fit in a slot");
+
+		for (u32 attempt = 0; attempt < 0x10000; ++attempt)
 		{
-			if (str == keyword)
+			WordTable table{ 2166136261u + attempt * 0x9E3779B9u };
+			bool collision = false;
+
+			for (size_t i = 0; i < Words.size() && !collision; ++i)
 			{
-				return true;
+				u8& slot = table.Slots[HashWord(Words[i].Text, table.Seed)];
+
+				collision = (slot != 0);
+				slot = static_cast<u8>(i + 1);
+			}
+
+			if (!collision)
+			{
+				return table;
 			}
 		}
 
-		return false;
+		throw "No perfect hash seed found for the word list";
+	}
+
+	constexpr WordTable WordHashTable = MakeWordTable();
+
+	constexpr TokenType LookupWord(std::string_view word)
+	{
+		const u8 slot = WordHashTable.Slots[HashWord(word, WordHashTable.Seed)];
+
+		return (slot != 0 && Words[slot - 1].Text == word) ? Words[slot - 1].Type : tUnknown;
 	}
 
-	static inline bool IsRegister(const std::string& str)
+	constexpr bool IsLetter(char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); }
+	constexpr bool IsDigit(char c)  { return c >= '0' && c <= '9'; }
+
+	/**
+	 * @brief A mnemonic template split into tokens, operand slots have type tUnknown.
+	 */
+	struct TemplateTokens
+	{
+		struct Piece
+		{
+			u8 Offset{};
+			u8 Length{};
+			TokenType Type{ tUnknown };
+			bool HasSpace{ false };
+		};
+
+		std::array<Piece, 8> Pieces{};
+		u8 Count{};
+	};
+
+	constexpr TemplateTokens TokenizeTemplate(std::string_view mnemonic)
 	{
-		for (const auto& reg : Registers)
+		TemplateTokens result;
+
+		auto add = [&result](size_t offset, size_t length, TokenType type, bool hasSpace)
 		{
-			if (str == reg)
+			if (result.Count == result.Pieces.size())
 			{
-				return true;
+				throw "Mnemonic template has too many tokens";
+			}
+
+			result.Pieces[result.Count++] = { static_cast<u8>(offset), static_cast<u8>(length), type, hasSpace };
+		};
+
+		size_t i = 0;
+
+		while (i < mnemonic.size())
+		{
+			const char c = mnemonic[i];
+			const size_t first = i;
+
+			if (c == '{')
+			{
+				add(first, 0, tUnknown, false);
+				i += 2;
+			}
+
+			else if (IsLetter(c))
+			{
+				while (i < mnemonic.size() && IsLetter(mnemonic[i])) ++i;
+
+				// words the lists do not know (GRP) are identifiers
+				const TokenType type = LookupWord(mnemonic.substr(first, i - first));
+
+				switch (type)
+				{
+				case tKeyword:  add(first, i - first, tKeyword, true); break;
+				case tRegister: add(first, i - first, tRegister, false); break;
+				default:        add(first, i - first, tIdentifier, true); break;
+				}
+			}
+
+			else if (IsDigit(c))
+			{
+				while (i < mnemonic.size() && IsDigit(mnemonic[i])) ++i;
+
+				add(first, i - first, tNumber, false);
+			}
+
+			else
+			{
+				switch (c)
+				{
+				case ',': add(first, 1, tComma, true); break;
+				case ':': add(first, 1, tColon, false); break;
+				default: break;
+				}
+
+				++i;
 			}
 		}
 
-		return false;
+		return result;
 	}
 
-	u8 Disassembler::Fetch()
+	constexpr auto MakeTemplates()
 	{
+		std::array<TemplateTokens, Disassembler::GROUP_ID_BASE + i8086::GroupTable.size()> templates{};
 
-		mTempInstruction.Bytes.push_back(mBus->Read(IP, 0x0000, 8));
+		for (size_t i = 0; i < i8086::OpcodeTable.size(); ++i)
+		{
+			templates[i] = TokenizeTemplate(i8086::OpcodeTable[i].Mnemonic);
+		}
 
-		return mBus->Read(IP++, 0x0000, 8);
-	
+		for (size_t i = 0; i < i8086::GroupTable.size(); ++i)
+		{
+			templates[Disassembler::GROUP_ID_BASE + i] = TokenizeTemplate(i8086::GroupTable[i].Mnemonic);
+		}
+
+		return templates;
 	}
 
-	u16 Disassembler::Fetch16()
+	// every template is classified once, at compile time, indexed by instruction id
+	constexpr auto Templates = MakeTemplates();
+
+	static inline void PushDecimal(TokenArena& arena, u16 value)
 	{
-		const u8 lowByte = Fetch();
-		const u8 highByte = Fetch();
+		char buffer[8];
+		const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
 
-		return (highByte << 8) | lowByte;
+		arena.Push({ buffer, static_cast<size_t>(result.ptr - buffer) }, tNumber);
 	}
 
-	void Disassembler::Decode(u8 opcode)
+	static inline void PushSignedDecimal(TokenArena& arena, s16 value, bool forceSign)
 	{
+		if (value < 0)
+		{
+			arena.Push("-", tMinus);
+		}
 
-		if (InstrTable[opcode].hasModRM)
+		else if (forceSign)
 		{
+			arena.Push("+", tPlus);
+		}
 
-			const u8 modrm = Fetch();
+		PushDecimal(arena, static_cast<u16>(value < 0 ? -value : value));
+	}
 
-			mMod = (modrm & 0xc0) >> 6;
-			mReg = (modrm & 0x38) >> 3;
-			mRm  =  modrm & 0x07;
+	static inline void PushHex16(TokenArena& arena, u16 value)
+	{
+		constexpr char digits[] = "0123456789ABCDEF";
 
-		}
+		const char buffer[6] = {
+			'0', 'x',
+			digits[(value >> 12) & 0xF], digits[(value >> 8) & 0xF],
+			digits[(value >> 4) & 0xF], digits[value & 0xF]
+		};
 
-		u8 index{};
+		arena.Push({ buffer, sizeof(buffer) }, tNumber);
+	}
 
-		switch (opcode)
-		{
-		case 0x80:
-			index = 8 * 0;
-			break;
+	static inline size_t EstimateRowCount(size_t size)
+	{
+		// code averages 2 to 3 bytes per instruction, random bytes a little under 2
+		return size / 2 + size / 8;
+	}
 
-		case 0x81:
-			index = 8 * 1;
-			break;
+	Disassembler::Disassembler(const i8086::IMemorySource* bus) : mBus(bus)
+	{
+	}
 
-		case 0x82:
-			index = 8 * 2;
-			break;
+	void Disassembler::Disassembly(u32 StartAddress, u32 EndAddress)
+	{
+		LoadSource(StartAddress, EndAddress);
 
-		case 0x83:
-			index = 8 * 3;
-			break;
+		DecodeRange(StartAddress, std::min<u32>(EndAddress, mCodeBase + static_cast<u32>(mCode.size())));
+	}
 
-		case 0x8C:
-			index = 8 * 4;
-			break;
+	void Disassembler::Disassembly(std::span<const u8> code, u32 baseAddress)
+	{
+		SetSource(code, baseAddress);
 
-		case 0x8E:
-			index = 8 * 5;
-			break;
+		DecodeRange(baseAddress, baseAddress + static_cast<u32>(code.size()));
 
-		case 0x8F:
-			index = 8 * 6;
-			break;
+		mCode = {};
+	}
 
-		case 0xC6:
-			index = 8 * 7;
-			break;
+	void Disassembler::LoadSource(u32 StartAddress, u32 EndAddress)
+	{
+		if (!mBus)
+		{
+			throw std::runtime_error("Disassembler::LoadSource -> Memory bus is not initialized");
+		}
 
-		case 0xC7:
-			index = 8 * 8;
-			break;
+		// the last instruction may extend past EndAddress, copy enough bytes to finish it
+		const u32 busEnd = static_cast<u32>(mBus->GetSize());
+		const u32 copyEnd = std::min(EndAddress + Instruction::MAX_BYTES - 1, busEnd);
 
-		case 0xD0:
-			index = 8 * 9;
-			break;
+		mBusBuffer.resize(copyEnd > StartAddress ? copyEnd - StartAddress : 0);
+		mBus->ReadBlock(StartAddress, mBusBuffer);
 
-		case 0xD1:
-			index = 8 * 10;
-			break;
+		// the slack is not part of the source, only instructions straddling the end read it
+		mCode = std::span<const u8>(mBusBuffer).first(std::min<size_t>(mBusBuffer.size(), EndAddress > StartAddress ? EndAddress - StartAddress : 0));
+		mCodeBase = StartAddress;
+	}
 
-		case 0xD2:
-			index = 8 * 11;
-			break;
+	void Disassembler::SetSource(std::span<const u8> code, u32 baseAddress)
+	{
+		mBusBuffer.clear();
 
-		case 0xD3:
-			index = 8 * 12;
-			break;
+		mCode = code;
+		mCodeBase = baseAddress;
+	}
 
-		case 0xF6:
-			index = 8 * 13;
-			break;
+	void Disassembler::DecodeRange(u32 StartAddress, u32 EndAddress)
+	{
+		const auto begin = std::chrono::steady_clock::now();
 
-		case 0xF7:
-			index = 8 * 14;
-			break;
+		mMaxInstrBytesCount = 0;
 
-		case 0xFE:
-			index = 8 * 15;
-			break;
+		// the bus copy carries the slack the last instruction may read
+		mListing.Reset(mBusBuffer.empty() ? mCode : std::span<const u8>(mBusBuffer), mCodeBase);
+		mListing.Reserve(EstimateRowCount(EndAddress > StartAddress ? EndAddress - StartAddress : 0));
 
-		case 0xFF:
-			index = 8 * 16;
-			break;
+		u32 ip = StartAddress;
 
-		default:
-			Tokenizer(GetInstrLine(InstrTable[opcode]), mTempInstruction.Tokens);
-			return;
-		}
+		while (ip < EndAddress)
+		{
+			Instruction instr;
+			instr.Address = ip;
+
+			Decode(instr, ip);
+			mListing.Push(instr);
 
-		index += mReg;
+			if (instr.Length > mMaxInstrBytesCount)
+			{
+				mMaxInstrBytesCount = instr.Length;
+			}
+		}
 
-		Tokenizer(GetInstrLine(GroupinstrTable[index]), mTempInstruction.Tokens);
+		mLastDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
 	}
 
-	std::string Disassembler::GetInstrLine(const Instr& instr)
+	void Disassembler::ParallelDisassembly(u32 StartAddress, u32 EndAddress, unsigned threadCount)
 	{
-		return std::vformat(instr.mnemonic, std::make_format_args(ParseOperand(instr.operand1), ParseOperand(instr.operand2)));
+		LoadSource(StartAddress, EndAddress);
+
+		DecodeRangeParallel(StartAddress, std::min<u32>(EndAddress, mCodeBase + static_cast<u32>(mCode.size())), threadCount);
 	}
 
-	const std::string Disassembler::ParseOperand(const OperandType& operandType)
+	void Disassembler::ParallelDisassembly(std::span<const u8> code, u32 baseAddress, unsigned threadCount)
 	{
-		return (this->*mOperandGetters[operandType])();
+		SetSource(code, baseAddress);
+
+		DecodeRangeParallel(baseAddress, baseAddress + static_cast<u32>(code.size()), threadCount);
+
+		mCode = {};
 	}
 
-	std::string Disassembler::GetRmAddressOperand()
+	void Disassembler::DecodeRangeParallel(u32 StartAddress, u32 EndAddress, unsigned threadCount)
 	{
+		struct Chunk
+		{
+			u32 Start{};
+			u32 End{};
+
+			std::vector<Instruction> Speculative;
+			u32 SpeculativeEnd{};
+
+			std::vector<Instruction> Resync; // real decode before it meets the speculative one
+			size_t KeepFrom{};               // first speculative instruction kept after Resync
+		};
+
+		if (threadCount == 0)
+		{
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		const u32 size = EndAddress > StartAddress ? EndAddress - StartAddress : 0;
+		const u32 chunkSize = std::max(PARALLEL_MIN_CHUNK_SIZE, (size + threadCount - 1) / threadCount);
+
+		if (size <= chunkSize)
+		{
+			DecodeRange(StartAddress, EndAddress);
+			return;
+		}
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		std::vector<Chunk> chunks((size + chunkSize - 1) / chunkSize);
 
-		std::format_args args = std::make_format_args();
-		
-		if (mMod == 0)
+		for (size_t i = 0; i < chunks.size(); ++i)
 		{
-			if (mRm != 6)
+			chunks[i].Start = StartAddress + static_cast<u32>(i) * chunkSize;
+			chunks[i].End = std::min(chunks[i].Start + chunkSize, EndAddress);
+		}
+
+		if (!mWorkers || mWorkers->GetThreadCount() != threadCount)
+		{
+			mWorkers = std::make_unique<ThreadPool>(threadCount);
+		}
+
+		// 1. speculative decode, each chunk from its first byte
+		mWorkers->ParallelFor(chunks.size(), [this, &chunks](size_t index)
+		{
+			Chunk& chunk = chunks[index];
+
+			chunk.Speculative.reserve((chunk.End - chunk.Start) / 2);
+
+			u32 ip = chunk.Start;
+
+			while (ip < chunk.End)
 			{
-				return ModrmLookUpTable[mMod][mRm];
+				Instruction& instr = chunk.Speculative.emplace_back();
+				instr.Address = ip;
+
+				Decode(instr, ip);
 			}
 
-			const u16 address = Fetch16();
-			args = std::make_format_args(address);
-		}
+			chunk.SpeculativeEnd = ip;
+		});
+
+		// 2. stitch, the first chunk is exact and every later one continues the real decode
+		u32 ip = chunks.front().SpeculativeEnd;
 
-		else if (mMod == 1)
+		for (size_t i = 1; i < chunks.size(); ++i)
 		{
-			const s16 signExtendedByte = static_cast<s8>(Fetch());
-			args = std::make_format_args(signExtendedByte);
+			Chunk& chunk = chunks[i];
+			const auto& speculative = chunk.Speculative;
+
+			auto it = speculative.begin();
+
+			while (ip < chunk.End)
+			{
+				it = std::lower_bound(it, speculative.end(), ip, [](const Instruction& instr, u32 address) { return instr.Address < address; });
+
+				if (it != speculative.end() && it->Address == ip)
+				{
+					break;
+				}
+
+				Instruction& instr = chunk.Resync.emplace_back();
+				instr.Address = ip;
+
+				Decode(instr, ip);
+			}
+
+			if (ip < chunk.End)
+			{
+				chunk.KeepFrom = static_cast<size_t>(it - speculative.begin());
+				ip = chunk.SpeculativeEnd;
+			}
+
+			else
+			{
+				chunk.KeepFrom = speculative.size();
+			}
 		}
 
-		else if (mMod == 2)
+		// 3. concatenate into the listing
+		mMaxInstrBytesCount = 0;
+
+		mListing.Reset(mBusBuffer.empty() ? mCode : std::span<const u8>(mBusBuffer), mCodeBase);
+		mListing.Reserve(EstimateRowCount(size));
+
+		auto append = [this](const Instruction& instr)
 		{
-			const u16 address = Fetch16();
-			args = std::make_format_args(address);
+			mMaxInstrBytesCount = std::max(mMaxInstrBytesCount, instr.Length);
+			mListing.Push(instr);
+		};
+
+		for (const auto& chunk : chunks)
+		{
+			for (const auto& instr : chunk.Resync)
+			{
+				append(instr);
+			}
+
+			for (size_t i = chunk.KeepFrom; i < chunk.Speculative.size(); ++i)
+			{
+				append(chunk.Speculative[i]);
+			}
 		}
 
-		return std::vformat(ModrmLookUpTable[mMod][mRm], args);
-	
+		mLastDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
 	}
 
-	std::string Disassembler::GetNoneOperand()
+	void Disassembler::DisassemblyAt(std::span<const u32> addresses)
 	{
-		return "";
-	}
+		disassembledInstructions.clear();
+		mTokenArena.Clear();
 
-	std::string Disassembler::GetImpliedOperand()
-	{
-		return "";
-	}
+		for (const u32 address : addresses)
+		{
+			Instruction& instr = disassembledInstructions.emplace_back();
+			instr.Address = address;
 
-	std::string Disassembler::GetRelativeOperand()
-	{
-		return std::to_string(static_cast<s8>(Fetch()));
-	}
+			u32 ip = address;
 
-	std::string Disassembler::GetSignExtendedOperand()
-	{
-		const s16 signExtendedByte = static_cast<s8>(Fetch());
-		return std::to_string(signExtendedByte);
+			Decode(instr, ip);
+			Format(instr, mTokenArena);
+		}
 	}
 
-	std::string Disassembler::GetI8Operand()
+	Instruction Disassembler::DecodeAt(u32 address) const
 	{
-		return std::to_string(Fetch());
-	}
+		Instruction instr;
+		instr.Address = address;
 
-	std::string Disassembler::GetI16Operand()
-	{
-		return std::to_string(Fetch16());
+		u32 ip = address;
+
+		Decode(instr, ip);
+
+		return instr;
 	}
 
-	std::string Disassembler::GetRm8Operand()
+	u8 Disassembler::DecodeLength(u32 address) const
 	{
-		
-		if (mMod != 3)
+		auto byteAt = [this](u32 at) -> u8
 		{
-			return "BYTE PTR " + GetRmAddressOperand();
-		}
+			const u32 offset = at - mCodeBase;
 
-		return ModrmLookUpTable[3][mRm];
+			return (offset < mCode.size()) ? mCode[offset] : (offset < mBusBuffer.size()) ? mBusBuffer[offset] : 0;
+		};
+
+		return i8086::GetInstructionLength(byteAt(address), byteAt(address + 1));
 	}
 
-	std::string Disassembler::GetRm16Operand()
+	u8 Disassembler::Fetch(Instruction& instr, u32& ip) const
 	{
-		if (mMod != 3)
+		const u32 offset = ip++ - mCodeBase;
+
+		if (offset < mCode.size())
 		{
-			return "WORD PTR " + GetRmAddressOperand();
+			return instr.Bytes[instr.Length++] = mCode[offset];
 		}
 
-		return ModrmLookUpTable[4][mRm];
-	}
+		// past the source, bytes copied from the bus as slack still complete the instruction,
+		// otherwise it decodes with zeros and keeps only its real bytes
+		if (offset < mBusBuffer.size())
+		{
+			return instr.Bytes[instr.Length++] = mBusBuffer[offset];
+		}
 
-	std::string Disassembler::GetR8Operand()
-	{
-		return ModrmLookUpTable[3][mReg];
+		return 0;
 	}
 
-	std::string Disassembler::GetR16Operand()
+	u16 Disassembler::Fetch16(Instruction& instr, u32& ip) const
 	{
-		return ModrmLookUpTable[4][mReg];
+		const u8 lowByte = Fetch(instr, ip);
+		const u8 highByte = Fetch(instr, ip);
+
+		return (highByte << 8) | lowByte;
 	}
 
-	std::string Disassembler::GetRegisterOverrideOperand()
+	void Disassembler::Decode(Instruction& instr, u32& ip) const
 	{
-		const u16 address = Fetch16();
-		const u16 segment = Fetch16();
+		const u8 opcode = Fetch(instr, ip);
+		const i8086::OpcodeInfo& opcodeInfo = i8086::OpcodeTable[opcode];
 
-		return std::format("0x{:04X}", segment) + ":" + std::format("0x{:04X}", address);
-	}
+		if (opcodeInfo.HasModRM)
+		{
+			instr.ModRM = Fetch(instr, ip);
+		}
 
-	std::string Disassembler::GetAddressOperand()
-	{
-		const u16 address = Fetch16();
-		return std::format("0x{:04X}", address);
+		const u8 reg = (instr.ModRM & 0x38) >> 3;
+
+		instr.Id = (opcodeInfo.Group < 0) ? opcode : static_cast<u16>(GROUP_ID_BASE + 8 * opcodeInfo.Group + reg);
+
+		const i8086::OpcodeInfo& entry = GetInstr(instr.Id);
+
+		instr.Operands[0].Type = entry.Operand1;
+		instr.Operands[1].Type = entry.Operand2;
+
+		// operands are encoded in order, displacement before immediate
+		DecodeOperand(instr, instr.Operands[0], ip);
+		DecodeOperand(instr, instr.Operands[1], ip);
 	}
 
-	void Disassembler::Tokenizer(const std::string& line, std::vector<Token>& tokens) const
+	void Disassembler::DecodeOperand(Instruction& instr, Operand& operand, u32& ip) const
 	{
-		size_t i = 0;
-		size_t lineSize = line.size();
+		const u8 mod = (instr.ModRM & 0xC0) >> 6;
+		const u8 rm  =  instr.ModRM & 0x07;
 
-		tokens.clear();
+		switch (operand.Type)
+		{
 
-		auto peek = [&](size_t offset = 0) -> char {
-			return (i + offset < lineSize) ? line[i + offset] : '\0';
-		};
+		case rel8:
+		case se8:
+		case i8:
+			operand.Value = Fetch(instr, ip);
+			break;
 
-		while (i < lineSize)
-		{
+		case rel16:
+		case i16:
+		case addr:
+			operand.Value = Fetch16(instr, ip);
+			break;
+
+		case segAddr:
+			operand.Value = Fetch16(instr, ip);
+			operand.Segment = Fetch16(instr, ip);
+			break;
 
-			if (std::isspace(peek()))
+		case rm8:
+		case rm16:
+			if (mod == 1)
 			{
-				++i;
+				operand.Value = Fetch(instr, ip);
 			}
 
-			if (std::isalpha(peek()))
+			else if (mod == 2 || (mod == 0 && rm == 6))
 			{
-				const size_t firstCharPos = i;
+				operand.Value = Fetch16(instr, ip);
+			}
+			break;
 
-				while (std::isalpha(peek())) i++;
+		default:
+			break;
+		}
+	}
 
-				const std::string word = line.substr(firstCharPos, i - firstCharPos);
+	void Disassembler::Format(Instruction& instr, TokenArena& arena) const
+	{
+		const char* mnemonic = GetInstr(instr.Id).Mnemonic;
+		const TemplateTokens& tokens = Templates[instr.Id];
 
-				if (IsKeyword(word))
-				{
-					tokens.push_back({ word, TokenType::tKeyword, true });
-				}
+		instr.Tokens.First = arena.GetTokenCount();
 
-				else if (IsRegister(word))
-				{
-					tokens.push_back({ word, TokenType::tRegister });
-				}
+		size_t operandIndex = 0;
 
-				else
-				{
-					tokens.push_back({ word, TokenType::tIdentifier, true });
-				}
+		for (u8 i = 0; i < tokens.Count; ++i)
+		{
+			const auto& piece = tokens.Pieces[i];
+
+			if (piece.Type != tUnknown)
+			{
+				arena.Push({ mnemonic + piece.Offset, piece.Length }, piece.Type, piece.HasSpace);
 			}
 
-			if (isdigit(peek()))
+			else if (operandIndex < instr.Operands.size())
 			{
+				FormatOperand(instr, instr.Operands[operandIndex++], arena);
+			}
+		}
 
-				const size_t firstCharPos = i;
+		instr.Tokens.Count = static_cast<u16>(arena.GetTokenCount() - instr.Tokens.First);
+	}
 
-				if (peek() == '0' && (peek(1) == 'x' || peek(1) == 'X'))
-				{
-					i += 2;
+	TokenType ClassifyWord(std::string_view word)
+	{
+		return LookupWord(word);
+	}
 
-					while (std::isxdigit(peek())) i++;
-				}
+	void Disassembler::FormatOperand(const Instruction& instr, const Operand& operand, TokenArena& arena) const
+	{
+		const u8 mod = (instr.ModRM & 0xC0) >> 6;
+		const u8 reg = (instr.ModRM & 0x38) >> 3;
+		const u8 rm  =  instr.ModRM & 0x07;
 
-				else
-				{
-					while (std::isdigit(peek())) i++;
-				}
+		switch (operand.Type)
+		{
 
-				const std::string number = line.substr(firstCharPos, i - firstCharPos);
+		case rel8:
+		case se8:
+			PushSignedDecimal(arena, static_cast<s8>(operand.Value), false);
+			break;
 
-				tokens.push_back({ number, TokenType::tNumber });
+		case rel16:
+			PushSignedDecimal(arena, static_cast<s16>(operand.Value), false);
+			break;
 
-			}
+		case i8:
+		case i16:
+			PushDecimal(arena, operand.Value);
+			break;
 
-			switch (peek())
-			{
+		case addr:
+			PushHex16(arena, operand.Value);
+			break;
 
-			case ',':
-				tokens.push_back({ ",", TokenType::tComma, true });
-				break;
+		case segAddr:
+			PushHex16(arena, operand.Segment);
+			arena.Push(":", tColon);
+			PushHex16(arena, operand.Value);
+			break;
 
-			case ':':
-				tokens.push_back({ ":", TokenType::tColon });
+		case rm8:
+			if (mod == 3)
+			{
+				arena.Push(Registers8[rm], tRegister);
 				break;
+			}
 
-			case '[':
-				tokens.push_back({ "[", TokenType::tLBracket });
-				break;
+			arena.Push("BYTE", tKeyword, true);
+			arena.Push("PTR", tKeyword, true);
+			FormatRmAddress(instr, operand, arena);
+			break;
 
-			case ']':
-				tokens.push_back({ "]", TokenType::tRBracket });
+		case rm16:
+			if (mod == 3)
+			{
+				arena.Push(Registers16[rm], tRegister);
 				break;
+			}
 
-			case '+':
-				tokens.push_back({ "+", TokenType::tPlus });
-				break;
+			arena.Push("WORD", tKeyword, true);
+			arena.Push("PTR", tKeyword, true);
+			FormatRmAddress(instr, operand, arena);
+			break;
 
-			case '-':
-				tokens.push_back({ "-", TokenType::tMinus });
-				break;
+		case r8:
+			arena.Push(Registers8[reg], tRegister);
+			break;
 
-			default:
-				break;
-			}
+		case r16:
+			arena.Push(Registers16[reg], tRegister);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void Disassembler::FormatRmAddress(const Instruction& instr, const Operand& operand, TokenArena& arena) const
+	{
+		const u8 mod = (instr.ModRM & 0xC0) >> 6;
+		const u8 rm  =  instr.ModRM & 0x07;
+
+		arena.Push("[", tLBracket);
+
+		if (mod == 0 && rm == 6)
+		{
+			PushHex16(arena, operand.Value);
+			arena.Push("]", tRBracket);
+			return;
+		}
 
-			++i;
+		const auto& bases = RmBaseRegisters[rm];
+
+		arena.Push(bases[0], tRegister);
+
+		if (bases[1])
+		{
+			arena.Push("+", tPlus);
+			arena.Push(bases[1], tRegister);
+		}
+
+		if (mod == 1)
+		{
+			PushSignedDecimal(arena, static_cast<s8>(operand.Value), true);
+		}
+
+		else if (mod == 2)
+		{
+			arena.Push("+", tPlus);
+			PushHex16(arena, operand.Value);
 		}
 
+		arena.Push("]", tRBracket);
 	}
 
 } // namespace disassembler
\ No newline at end of file
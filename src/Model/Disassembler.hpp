@@ -5,115 +5,206 @@
 #pragma once
 
 #include <Utils/types.hpp>
-#include "MemoryBus.hpp"
+#include <Utils/ThreadPool.hpp>
+#include <Interfaces/IMemorySource.hpp>
+#include "Listing.hpp"
+#include "OpcodeTable.hpp"
 #include "Token.hpp"
 
+#include <array>
+#include <memory>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
 
 namespace disassembler
 {
 
-	enum OperandType : s8
+	using i8086::OperandType;
+	using enum i8086::OperandType;
+
+	/**
+	 * @brief Decoded value of an instruction operand.
+	 *
+	 * @details
+	 * Value holds the immediate, relative offset, direct address or ModR/M displacement
+	 * (raw, before sign extension), Segment the segment of a far pointer.
+	 */
+	struct Operand
 	{
-		none,
-		implied,
-		rel8,
-		se8,
-		i8,
-		i16,
-		rm8,
-		rm16,
-		r8,
-		r16,
-		addr,
-		segAddr
+		OperandType Type{ none };
+		u16 Value{};
+		u16 Segment{};
 	};
 
-	struct DisassembledInstruction
+	/**
+	 * @brief Fixed-size record of a decoded instruction.
+	 *
+	 * @details
+	 * 8086 instructions are at most 6 bytes long (opcode, ModR/M, 16-bit displacement and
+	 * 16-bit immediate; prefixes are listed as instructions of their own), so the raw bytes
+	 * are kept inline. The text is produced separately into a TokenArena.
+	 */
+	struct Instruction
 	{
-		u32 Address{};
-		std::vector<u8> Bytes;
-		std::vector<Token> Tokens{};
-		bool Breakpoint{ false };
-
-		void Clear()
-		{
-			Address = 0;
-			Bytes.clear();
-			Tokens.clear();
-			Breakpoint = false;
-		}
+		static constexpr u8 MAX_BYTES = 6;
 
+		u32 Address{};
+		std::array<u8, MAX_BYTES> Bytes{};
+		u8 Length{};
+		u8 ModRM{};
+		u16 Id{}; // index in OpcodeTable, or GROUP_ID_BASE + index in GroupTable
+		std::array<Operand, 2> Operands{};
+		TokenSpan Tokens{};
 	};
 
-	struct Instr
-	{
-		constexpr Instr(const char* m = "", OperandType o1 = none, OperandType o2 = none, bool hasModRM = false)
-			: mnemonic(m), operand1(o1), operand2(o2), hasModRM(hasModRM) {
-		}
-
-		const char* mnemonic{};
-		const OperandType operand1;
-		const OperandType operand2;
-		const bool hasModRM{ false };
-	};
+	/**
+	 * @brief tKeyword or tRegister for a known mnemonic, size keyword or register name, tUnknown otherwise.
+	 *
+	 * @details
+	 * One perfect-hash lookup. Decoded instructions do not need it, their token types are
+	 * known when they are produced; it is meant for text from elsewhere (e.g. typed input).
+	 */
+	TokenType ClassifyWord(std::string_view word);
 
 	class Disassembler
 	{
 
 	public:
 
-		Disassembler(const i8086::MemoryBus* bus);
+		static constexpr u16 GROUP_ID_BASE = 256;
+		static constexpr u32 PARALLEL_MIN_CHUNK_SIZE = 64 * 1024;
 
+		Disassembler(const i8086::IMemorySource* bus = nullptr);
+
+		/**
+		 * @brief Disassembles [StartAddress, EndAddress) of the physical address space into GetListing().
+		 *
+		 * @details
+		 * The range is copied out of the bus in one block transfer and decoded from there.
+		 * Rows are not formatted, Format(GetListing().Get(row), arena) produces the text of the
+		 * rows that are shown.
+		 */
 		void Disassembly(u32 StartAddress, u32 EndAddress);
+
+		/**
+		 * @brief Disassembles a buffer (e.g. a raw binary file) as if it were loaded at baseAddress.
+		 *
+		 * @details
+		 * Does not need a bus. The buffer must outlive the call only, the listing keeps a copy.
+		 */
+		void Disassembly(std::span<const u8> code, u32 baseAddress = 0);
+
+		/**
+		 * @brief Same listing as Disassembly, decoded by several threads.
+		 *
+		 * @details
+		 * The range is split in one chunk per thread and every chunk is decoded from its first
+		 * byte, which may be in the middle of an instruction. Chunks are then stitched in order:
+		 * the real decode coming from the previous chunk is continued until it lands on an
+		 * address the speculative decode also produced, from there both agree and the rest of
+		 * the chunk is kept. threadCount 0 uses all cores. The worker threads are started by
+		 * the first call and reused by the next ones with the same count.
+		 */
+		void ParallelDisassembly(u32 StartAddress, u32 EndAddress, unsigned threadCount = 0);
+		void ParallelDisassembly(std::span<const u8> code, u32 baseAddress = 0, unsigned threadCount = 0);
+
+		/**
+		 * @brief Copies [StartAddress, EndAddress) out of the bus and makes it the decode source.
+		 */
+		void LoadSource(u32 StartAddress, u32 EndAddress);
+
+		/**
+		 * @brief Decodes from a caller-owned buffer, which must stay alive while it is the source.
+		 */
+		void SetSource(std::span<const u8> code, u32 baseAddress);
+
+		std::span<const u8> GetSource() const
+		{
+			return mCode;
+		}
+
+		/**
+		 * @brief Decodes and formats one instruction at each of the given addresses of the source.
+		 *
+		 * @details
+		 * Used to fill only the rows a listing shows, the addresses come from an InstructionIndex.
+		 */
+		void DisassemblyAt(std::span<const u32> addresses);
+
+		/**
+		 * @brief Decodes the instruction at address of the source, without formatting it.
+		 */
+		Instruction DecodeAt(u32 address) const;
+
+		/**
+		 * @brief Length of the instruction at address, without formatting it.
+		 */
+		u8 DecodeLength(u32 address) const;
+
+		/**
+		 * @brief Produces the tokens of a decoded instruction into the arena and records their span.
+		 */
+		void Format(Instruction& instr, TokenArena& arena) const;
 		
 		u8 GetMaxInstrBytesCount() const
 		{
 			return mMaxInstrBytesCount;
 		}
 
+		const TokenArena& GetTokenArena() const
+		{
+			return mTokenArena;
+		}
+
+		/**
+		 * @brief Decode throughput of the last Disassembly call, in instructions per second.
+		 */
+		double GetInstructionsPerSecond() const
+		{
+			return mLastDuration > 0.0 ? mListing.Size() / mLastDuration : 0.0;
+		}
+
+		/**
+		 * @brief Result of the last Disassembly or ParallelDisassembly call.
+		 */
+		const Listing& GetListing() const
+		{
+			return mListing;
+		}
+
 	public:
 
-		std::vector<DisassembledInstruction> disassembledInstructions;
+		// rows decoded and formatted by DisassemblyAt
+
+		std::vector<Instruction> disassembledInstructions;
 
 	private:
 
-		u8 Fetch();
-		u16 Fetch16();
-		void Decode(u8 opcode);
-		std::string GetInstrLine(const Instr& instr);
-		const std::string ParseOperand(const OperandType& operandType);
-
-		std::string GetRmAddressOperand();
-		std::string GetNoneOperand();
-		std::string GetImpliedOperand();
-		std::string GetRelativeOperand();
-		std::string GetSignExtendedOperand();
-		std::string GetI8Operand();
-		std::string GetI16Operand();
-		std::string GetRm8Operand();
-		std::string GetRm16Operand();
-		std::string GetR8Operand();
-		std::string GetR16Operand();
-		std::string GetRegisterOverrideOperand();
-		std::string GetAddressOperand();
-
-		void Tokenizer(const std::string& line, std::vector<Token>& tokens) const;
+		void DecodeRange(u32 StartAddress, u32 EndAddress);
+		void DecodeRangeParallel(u32 StartAddress, u32 EndAddress, unsigned threadCount);
+
+		u8 Fetch(Instruction& instr, u32& ip) const;
+		u16 Fetch16(Instruction& instr, u32& ip) const;
+		void Decode(Instruction& instr, u32& ip) const;
+		void DecodeOperand(Instruction& instr, Operand& operand, u32& ip) const;
+
+		void FormatOperand(const Instruction& instr, const Operand& operand, TokenArena& arena) const;
+		void FormatRmAddress(const Instruction& instr, const Operand& operand, TokenArena& arena) const;
 
 	private:
 
-		const i8086::MemoryBus* const mBus;
-		std::unordered_map<OperandType, std::string(Disassembler::*)(void)> mOperandGetters;
+		const i8086::IMemorySource* const mBus;
 
-		DisassembledInstruction mTempInstruction;
-		u8 mMaxInstrBytesCount{ 0 };
+		std::span<const u8> mCode;
+		u32 mCodeBase{ 0 };
+		std::vector<u8> mBusBuffer;
 
-		u32 IP{ 0 };
+		Listing mListing;
+		TokenArena mTokenArena;
+		u8 mMaxInstrBytesCount{ 0 };
+		double mLastDuration{ 0.0 };
 
-		u8 mMod{};
-		u8 mReg{};
-		u8 mRm{};
+		std::unique_ptr<ThreadPool> mWorkers; // of ParallelDisassembly
 	};
 
 } // namespace disassembler
\ No newline at end of file
@@ -0,0 +1,295 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "DiskController.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace i8086
+{
+
+	constexpr u32 MIN_PREFETCH_SECTORS = 64;
+
+	DiskController::DiskController(MemoryBus* const bus) : mBus(bus)
+	{
+		if (!mBus)
+		{
+			throw std::runtime_error("DiskController::DiskController -> Memory bus is not initialized");
+		}
+
+		mPrefetchThread = std::thread(&DiskController::PrefetchWorker, this);
+	}
+
+	DiskController::~DiskController()
+	{
+		{
+			std::lock_guard lock(mPrefetchMutex);
+			mStopPrefetch = true;
+		}
+
+		mPrefetchCondition.notify_one();
+		mPrefetchThread.join();
+	}
+
+	void DiskController::Mount(u8 drive, const std::filesystem::path& path, bool readOnly)
+	{
+		Drive* target = GetDrive(drive);
+
+		if (target == nullptr)
+		{
+			throw std::runtime_error("DiskController::Mount -> Invalid drive number");
+		}
+
+		target->Image = std::make_shared<DiskImage>(path, readOnly);
+		target->NextSequentialLBA = 0;
+	}
+
+	void DiskController::Eject(u8 drive)
+	{
+		Drive* target = GetDrive(drive);
+
+		if (target != nullptr)
+		{
+			// a prefetch in flight keeps its own reference, the mapping goes away once it ends
+			target->Image.reset();
+		}
+	}
+
+	bool DiskController::IsMounted(u8 drive) const
+	{
+		const Drive* target = GetDrive(drive);
+
+		return target != nullptr && target->Image != nullptr;
+	}
+
+	DiskController::Drive* DiskController::GetDrive(u8 drive)
+	{
+		return const_cast<Drive*>(std::as_const(*this).GetDrive(drive));
+	}
+
+	const DiskController::Drive* DiskController::GetDrive(u8 drive) const
+	{
+		const auto& drives = (drive & 0x80) ? mFixedDisks : mFloppies;
+		const u8 index = drive & 0x7F;
+
+		return (index < drives.size()) ? &drives[index] : nullptr;
+	}
+
+	bool DiskController::HandleInterrupt(u8 vector, CPUState& state)
+	{
+		if (vector != INT_VECTOR)
+		{
+			return false;
+		}
+
+		Drive* drive = GetDrive(state.D.L);
+		const bool mounted = drive != nullptr && drive->Image != nullptr;
+
+		Status status = Ok;
+
+		switch (state.A.H)
+		{
+
+		case 0x00: // reset disk system
+			status = mounted ? Ok : NotReady;
+			break;
+
+		case 0x01: // status of last operation
+			state.A.L = mLastStatus;
+			state.A.H = Ok;
+			state.SF.C = false;
+			return true;
+
+		case 0x02: // read sectors into ES:BX
+			status = mounted ? ReadSectors(state, *drive) : NotReady;
+			break;
+
+		case 0x03: // write sectors from ES:BX
+			status = mounted ? WriteSectors(state, *drive) : NotReady;
+			break;
+
+		case 0x08: // drive parameters
+			status = mounted ? GetParameters(state, *drive) : NotReady;
+			break;
+
+		case 0x15: // disk type
+			GetDiskType(state, mounted ? drive : nullptr);
+			return true;
+
+		default:
+			status = InvalidCommand;
+			break;
+		}
+
+		state.A.H = status;
+		state.SF.C = (status != Ok);
+		mLastStatus = status;
+
+		return true;
+	}
+
+	bool DiskController::TranslateCHS(const CPUState& state, const DiskImage& image, u32& lba) const
+	{
+		const DiskGeometry& geometry = image.GetGeometry();
+
+		const u16 cylinder = static_cast<u16>(state.C.H) | ((static_cast<u16>(state.C.L) & 0xC0) << 2);
+		const u8 sector = state.C.L & 0x3F;
+		const u8 head = state.D.H;
+
+		if (sector == 0 || sector > geometry.SectorsPerTrack || head >= geometry.Heads || cylinder >= geometry.Cylinders)
+		{
+			return false;
+		}
+
+		lba = (static_cast<u32>(cylinder) * geometry.Heads + head) * geometry.SectorsPerTrack + (sector - 1);
+
+		return true;
+	}
+
+	DiskController::Status DiskController::ReadSectors(CPUState& state, Drive& drive)
+	{
+		const u8 count = state.A.L;
+		u32 lba{};
+
+		if (count == 0 || !TranslateCHS(state, *drive.Image, lba) || lba + count > drive.Image->GetSectorCount())
+		{
+			return SectorNotFound;
+		}
+
+		const u32 bufferAddress = (static_cast<u32>(state.ES.X) << 4) + state.B.X;
+
+		// one copy, from the host page cache straight into guest memory
+		mBus->WriteBlock(bufferAddress, drive.Image->GetSectors(lba, count));
+
+		const bool sequential = (lba == drive.NextSequentialLBA);
+		drive.NextSequentialLBA = lba + count;
+
+		if (sequential)
+		{
+			RequestPrefetch(drive, lba + count, std::max<u32>(count * 2u, MIN_PREFETCH_SECTORS));
+		}
+
+		return Ok;
+	}
+
+	DiskController::Status DiskController::WriteSectors(CPUState& state, Drive& drive)
+	{
+		const u8 count = state.A.L;
+		u32 lba{};
+
+		if (drive.Image->IsReadOnly())
+		{
+			return WriteProtected;
+		}
+
+		if (count == 0 || !TranslateCHS(state, *drive.Image, lba) || lba + count > drive.Image->GetSectorCount())
+		{
+			return SectorNotFound;
+		}
+
+		const u32 bufferAddress = (static_cast<u32>(state.ES.X) << 4) + state.B.X;
+
+		mBus->ReadBlock(bufferAddress, drive.Image->GetWritableSectors(lba, count));
+
+		drive.NextSequentialLBA = lba + count;
+
+		return Ok;
+	}
+
+	DiskController::Status DiskController::GetParameters(CPUState& state, const Drive& drive)
+	{
+		const DiskGeometry& geometry = drive.Image->GetGeometry();
+		const u16 maxCylinder = geometry.Cylinders - 1;
+
+		state.C.H = maxCylinder & 0xFF;
+		state.C.L = (geometry.SectorsPerTrack & 0x3F) | ((maxCylinder >> 2) & 0xC0);
+		state.D.H = geometry.Heads - 1;
+		state.A.L = 0;
+
+		const bool floppy = drive.Image->IsFloppy();
+		const auto& drives = floppy ? mFloppies : mFixedDisks;
+
+		state.D.L = static_cast<u8>(std::count_if(drives.begin(), drives.end(), [](const Drive& d) { return d.Image != nullptr; }));
+
+		if (floppy)
+		{
+			// CMOS drive type: 1 = 360K, 2 = 1.2M, 3 = 720K, 4 = 1.44M, 6 = 2.88M
+			switch (geometry.SectorsPerTrack)
+			{
+			case 15: state.B.L = 2; break;
+			case 18: state.B.L = 4; break;
+			case 36: state.B.L = 6; break;
+			default: state.B.L = (geometry.Cylinders == 80) ? 3 : 1; break;
+			}
+
+			// no diskette parameter table is provided
+			state.ES = 0x0000;
+			state.DI = 0x0000;
+		}
+
+		return Ok;
+	}
+
+	void DiskController::GetDiskType(CPUState& state, const Drive* drive)
+	{
+		state.SF.C = false;
+
+		if (drive == nullptr)
+		{
+			state.A.H = 0x00; // no drive
+			return;
+		}
+
+		if (drive->Image->IsFloppy())
+		{
+			state.A.H = 0x01; // diskette without change-line support
+			return;
+		}
+
+		const u32 sectorCount = drive->Image->GetSectorCount();
+
+		state.A.H = 0x03; // fixed disk, CX:DX = number of sectors
+		state.C = static_cast<u16>(sectorCount >> 16);
+		state.D = static_cast<u16>(sectorCount & 0xFFFF);
+	}
+
+	void DiskController::RequestPrefetch(const Drive& drive, u32 lba, u32 count)
+	{
+		{
+			std::lock_guard lock(mPrefetchMutex);
+
+			// only the most recent request matters, an older one still queued is replaced
+			mPrefetchRequest = { drive.Image, lba, count };
+			mPrefetchPending = true;
+		}
+
+		mPrefetchCondition.notify_one();
+	}
+
+	void DiskController::PrefetchWorker()
+	{
+		while (true)
+		{
+			PrefetchRequest request;
+
+			{
+				std::unique_lock lock(mPrefetchMutex);
+				mPrefetchCondition.wait(lock, [this] { return mPrefetchPending || mStopPrefetch; });
+
+				if (mStopPrefetch)
+				{
+					return;
+				}
+
+				request = std::move(mPrefetchRequest);
+				mPrefetchPending = false;
+			}
+
+			request.Image->Prefetch(request.LBA, request.Count);
+		}
+	}
+
+} // namespace i8086
@@ -0,0 +1,99 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "DiskImage.hpp"
+#include "MemoryBus.hpp"
+
+#include <Interfaces/IInterruptHandler.hpp>
+#include <Utils/types.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace i8086
+{
+
+	/**
+	 * @brief INT 13h disk service backed by mapped image files.
+	 *
+	 * @details
+	 * Drives 0x00-0x01 are floppies and 0x80-0x81 fixed disks. Sector transfers copy between
+	 * the image mapping and guest memory through the bus block path. When a read continues
+	 * where the previous one on the same drive ended, the following sectors are prefetched
+	 * on a helper thread so sequential file copies rarely wait on host I/O.
+	 */
+	class DiskController : public IInterruptHandler
+	{
+
+	public:
+
+		static constexpr u8 INT_VECTOR = 0x13;
+
+		DiskController(MemoryBus* const bus);
+		~DiskController();
+
+		void Mount(u8 drive, const std::filesystem::path& path, bool readOnly = false);
+		void Eject(u8 drive);
+		bool IsMounted(u8 drive) const;
+
+		bool HandleInterrupt(u8 vector, CPUState& state) override;
+
+	private:
+
+		enum Status : u8
+		{
+			Ok              = 0x00,
+			InvalidCommand  = 0x01,
+			WriteProtected  = 0x03,
+			SectorNotFound  = 0x04,
+			NotReady        = 0x80
+		};
+
+		struct Drive
+		{
+			std::shared_ptr<DiskImage> Image;
+			u32 NextSequentialLBA{ 0 };
+		};
+
+		struct PrefetchRequest
+		{
+			std::shared_ptr<DiskImage> Image;
+			u32 LBA{ 0 };
+			u32 Count{ 0 };
+		};
+
+		Drive* GetDrive(u8 drive);
+		const Drive* GetDrive(u8 drive) const;
+
+		Status ReadSectors(CPUState& state, Drive& drive);
+		Status WriteSectors(CPUState& state, Drive& drive);
+		Status GetParameters(CPUState& state, const Drive& drive);
+		void GetDiskType(CPUState& state, const Drive* drive);
+
+		bool TranslateCHS(const CPUState& state, const DiskImage& image, u32& lba) const;
+		void RequestPrefetch(const Drive& drive, u32 lba, u32 count);
+		void PrefetchWorker();
+
+	private:
+
+		MemoryBus* const mBus;
+
+		std::array<Drive, 2> mFloppies;
+		std::array<Drive, 2> mFixedDisks;
+		u8 mLastStatus{ Ok };
+
+		std::thread mPrefetchThread;
+		std::mutex mPrefetchMutex;
+		std::condition_variable mPrefetchCondition;
+		PrefetchRequest mPrefetchRequest;
+		bool mPrefetchPending{ false };
+		bool mStopPrefetch{ false };
+	};
+
+} // namespace i8086
@@ -0,0 +1,250 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "DiskImage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace i8086
+{
+
+	constexpr size_t HOST_PAGE_SIZE = 4096;
+
+	struct FloppyFormat
+	{
+		size_t Size;
+		DiskGeometry Geometry;
+	};
+
+	constexpr std::array<FloppyFormat, 8> FloppyFormats =
+	{{
+		{  163840, { 40, 1,  8 } }, // 160 KiB
+		{  184320, { 40, 1,  9 } }, // 180 KiB
+		{  327680, { 40, 2,  8 } }, // 320 KiB
+		{  368640, { 40, 2,  9 } }, // 360 KiB
+		{  737280, { 80, 2,  9 } }, // 720 KiB
+		{ 1228800, { 80, 2, 15 } }, // 1.2 MiB
+		{ 1474560, { 80, 2, 18 } }, // 1.44 MiB
+		{ 2949120, { 80, 2, 36 } }  // 2.88 MiB
+	}};
+
+	DiskImage::DiskImage(const std::filesystem::path& path, bool readOnly) : mReadOnly(readOnly)
+	{
+		Map(path);
+		DetectGeometry();
+	}
+
+	DiskImage::~DiskImage()
+	{
+		Unmap();
+	}
+
+#ifdef _WIN32
+
+	void DiskImage::Map(const std::filesystem::path& path)
+	{
+		const DWORD access = mReadOnly ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE);
+
+		HANDLE file = CreateFileW(path.c_str(), access, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			throw std::runtime_error("DiskImage::Map -> Cannot open the image file");
+		}
+
+		mFileHandle = file;
+
+		LARGE_INTEGER size{};
+		GetFileSizeEx(file, &size);
+		mSize = static_cast<size_t>(size.QuadPart);
+
+		if (mSize < SECTOR_SIZE)
+		{
+			Unmap();
+			throw std::runtime_error("DiskImage::Map -> Image is smaller than a sector");
+		}
+
+		mMappingHandle = CreateFileMappingW(file, nullptr, mReadOnly ? PAGE_READONLY : PAGE_READWRITE, 0, 0, nullptr);
+
+		if (mMappingHandle == nullptr)
+		{
+			Unmap();
+			throw std::runtime_error("DiskImage::Map -> Cannot map the image file");
+		}
+
+		mData = static_cast<u8*>(MapViewOfFile(mMappingHandle, mReadOnly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0));
+
+		if (mData == nullptr)
+		{
+			Unmap();
+			throw std::runtime_error("DiskImage::Map -> Cannot map the image file");
+		}
+	}
+
+	void DiskImage::Unmap()
+	{
+		if (mData)
+		{
+			UnmapViewOfFile(mData);
+			mData = nullptr;
+		}
+
+		if (mMappingHandle)
+		{
+			CloseHandle(mMappingHandle);
+			mMappingHandle = nullptr;
+		}
+
+		if (mFileHandle)
+		{
+			CloseHandle(mFileHandle);
+			mFileHandle = nullptr;
+		}
+	}
+
+#else
+
+	void DiskImage::Map(const std::filesystem::path& path)
+	{
+		mFileDescriptor = open(path.c_str(), mReadOnly ? O_RDONLY : O_RDWR);
+
+		if (mFileDescriptor < 0)
+		{
+			throw std::runtime_error("DiskImage::Map -> Cannot open the image file");
+		}
+
+		struct stat info{};
+		fstat(mFileDescriptor, &info);
+		mSize = static_cast<size_t>(info.st_size);
+
+		if (mSize < SECTOR_SIZE)
+		{
+			Unmap();
+			throw std::runtime_error("DiskImage::Map -> Image is smaller than a sector");
+		}
+
+		const int protection = mReadOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+		void* data = mmap(nullptr, mSize, protection, MAP_SHARED, mFileDescriptor, 0);
+
+		if (data == MAP_FAILED)
+		{
+			Unmap();
+			throw std::runtime_error("DiskImage::Map -> Cannot map the image file");
+		}
+
+		mData = static_cast<u8*>(data);
+
+		// guests mostly read files front to back
+		madvise(mData, mSize, MADV_SEQUENTIAL);
+	}
+
+	void DiskImage::Unmap()
+	{
+		if (mData)
+		{
+			munmap(mData, mSize);
+			mData = nullptr;
+		}
+
+		if (mFileDescriptor >= 0)
+		{
+			close(mFileDescriptor);
+			mFileDescriptor = -1;
+		}
+	}
+
+#endif
+
+	void DiskImage::DetectGeometry()
+	{
+		for (const auto& format : FloppyFormats)
+		{
+			if (format.Size == mSize)
+			{
+				mGeometry = format.Geometry;
+				mFloppy = true;
+				return;
+			}
+		}
+
+		// fixed disks use the usual translated geometry of 16 heads and 63 sectors per track
+		constexpr u8 heads = 16;
+		constexpr u8 sectorsPerTrack = 63;
+
+		const size_t cylinders = mSize / (SECTOR_SIZE * heads * sectorsPerTrack);
+
+		mGeometry = { static_cast<u16>(std::min<size_t>(std::max<size_t>(cylinders, 1), 1024)), heads, sectorsPerTrack };
+		mFloppy = false;
+	}
+
+	void DiskImage::CheckRange(u32 lba, u32 count) const
+	{
+		if (lba > GetSectorCount() || count > GetSectorCount() - lba)
+		{
+			throw std::out_of_range("DiskImage -> Sector range is outside of the image");
+		}
+	}
+
+	std::span<const u8> DiskImage::GetSectors(u32 lba, u32 count) const
+	{
+		CheckRange(lba, count);
+
+		return { mData + static_cast<size_t>(lba) * SECTOR_SIZE, static_cast<size_t>(count) * SECTOR_SIZE };
+	}
+
+	std::span<u8> DiskImage::GetWritableSectors(u32 lba, u32 count)
+	{
+		if (mReadOnly)
+		{
+			throw std::runtime_error("DiskImage::GetWritableSectors -> Image is read-only");
+		}
+
+		CheckRange(lba, count);
+
+		return { mData + static_cast<size_t>(lba) * SECTOR_SIZE, static_cast<size_t>(count) * SECTOR_SIZE };
+	}
+
+	void DiskImage::Prefetch(u32 lba, u32 count) const
+	{
+		const u32 sectorCount = GetSectorCount();
+
+		if (lba >= sectorCount)
+		{
+			return;
+		}
+
+		count = std::min(count, sectorCount - lba);
+
+		const size_t begin = static_cast<size_t>(lba) * SECTOR_SIZE;
+		const size_t end = begin + static_cast<size_t>(count) * SECTOR_SIZE;
+
+#ifndef _WIN32
+		const size_t alignedBegin = begin & ~(HOST_PAGE_SIZE - 1);
+		madvise(mData + alignedBegin, end - alignedBegin, MADV_WILLNEED);
+#endif
+
+		// touching one byte per page makes the fault, and so the disk read, happen here
+		// rather than on the emulation thread
+		volatile u8 sink = 0;
+
+		for (size_t offset = begin; offset < end; offset += HOST_PAGE_SIZE)
+		{
+			sink = sink + mData[offset];
+		}
+	}
+
+} // namespace i8086
@@ -0,0 +1,82 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <filesystem>
+#include <span>
+
+namespace i8086
+{
+
+	struct DiskGeometry
+	{
+		u16 Cylinders{};
+		u8 Heads{};
+		u8 SectorsPerTrack{};
+	};
+
+	/**
+	 * @brief Raw disk image mapped into the host address space.
+	 *
+	 * @details
+	 * Sectors are served straight from the mapping, so a guest read is a single copy from
+	 * the host page cache into guest memory. Writes go to the mapping and reach the file
+	 * through the OS.
+	 */
+	class DiskImage
+	{
+
+	public:
+
+		static constexpr size_t SECTOR_SIZE = 512;
+
+		DiskImage(const std::filesystem::path& path, bool readOnly = false);
+		~DiskImage();
+
+		DiskImage(const DiskImage&) = delete;
+		DiskImage& operator=(const DiskImage&) = delete;
+
+		std::span<const u8> GetSectors(u32 lba, u32 count) const;
+		std::span<u8> GetWritableSectors(u32 lba, u32 count);
+
+		/**
+		 * @brief Hints the OS to start reading the given sectors and faults their pages in.
+		 *
+		 * @details
+		 * Blocking, meant to be called from a helper thread ahead of the guest.
+		 */
+		void Prefetch(u32 lba, u32 count) const;
+
+		const DiskGeometry& GetGeometry() const { return mGeometry; }
+		u32 GetSectorCount() const { return static_cast<u32>(mSize / SECTOR_SIZE); }
+		bool IsFloppy() const { return mFloppy; }
+		bool IsReadOnly() const { return mReadOnly; }
+
+	private:
+
+		void Map(const std::filesystem::path& path);
+		void Unmap();
+		void DetectGeometry();
+		void CheckRange(u32 lba, u32 count) const;
+
+	private:
+
+		u8* mData{ nullptr };
+		size_t mSize{ 0 };
+		bool mReadOnly{ false };
+		bool mFloppy{ false };
+		DiskGeometry mGeometry{};
+
+#ifdef _WIN32
+		void* mFileHandle{ nullptr };
+		void* mMappingHandle{ nullptr };
+#else
+		int mFileDescriptor{ -1 };
+#endif
+	};
+
+} // namespace i8086
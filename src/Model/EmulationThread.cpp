@@ -0,0 +1,413 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "EmulationThread.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+
+namespace i8086
+{
+
+	EmulationThread::EmulationThread(I8086* cpu, MemoryBus* bus, TextModeAdapter* textModeAdapter)
+		: mCpu(cpu), mBus(bus), mTextModeAdapter(textModeAdapter)
+	{
+		if (!mCpu || !mBus)
+		{
+			throw std::runtime_error("EmulationThread::EmulationThread -> CPU or memory bus is not initialized");
+		}
+	}
+
+	EmulationThread::~EmulationThread()
+	{
+		Stop();
+
+		if (mRecordingAccesses)
+		{
+			mBus->UnregisterObserver(&mAccesses);
+		}
+
+		if (mHeatMapping)
+		{
+			mBus->UnregisterObserver(&mHeatMap);
+		}
+	}
+
+	void EmulationThread::Start()
+	{
+		if (mThread.joinable())
+		{
+			return;
+		}
+
+		mStop = false;
+
+		// the UI has something to show before the first command
+		Publish();
+		mSnapshots.Acquire();
+
+		mThread = std::thread(&EmulationThread::Worker, this);
+	}
+
+	void EmulationThread::Stop()
+	{
+		mStop = true;
+
+		mWakeups.fetch_add(1, std::memory_order_release);
+		mWakeups.notify_one();
+
+		if (mThread.joinable())
+		{
+			mThread.join();
+		}
+	}
+
+	bool EmulationThread::Post(Command command)
+	{
+		if (!mCommands.TryPush(std::move(command)))
+		{
+			return false;
+		}
+
+		mWakeups.fetch_add(1, std::memory_order_release);
+		mWakeups.notify_one();
+
+		return true;
+	}
+
+	void EmulationThread::Worker()
+	{
+		auto lastPublish = Clock::now();
+
+		while (!mStop)
+		{
+			// read before draining, a command posted after the drain changes it and ends the wait
+			const u32 wakeups = mWakeups.load(std::memory_order_acquire);
+
+			bool executed = false;
+			Command command;
+
+			while (mCommands.TryPop(command))
+			{
+				Execute(command);
+				executed = true;
+			}
+
+			if (mRunning)
+			{
+				const u64 cyclesBefore = mCpu->GetCycleCount();
+				const auto sliceStart = Clock::now();
+
+				RunSlice();
+
+				const auto now = Clock::now();
+				mBusySeconds += std::chrono::duration<double>(now - sliceStart).count();
+				UpdateClockRate(now);
+
+				// halted with no event scheduled to wake it, only a command can change anything
+				const bool idle = mRunning && mCpu->IsHalted() && mCpu->GetCycleCount() == cyclesBefore;
+
+				if (executed || idle || !mRunning || std::chrono::duration<double>(now - lastPublish).count() >= PUBLISH_INTERVAL)
+				{
+					Publish();
+					lastPublish = now;
+				}
+
+				if (idle)
+				{
+					mWakeups.wait(wakeups, std::memory_order_acquire);
+					RestartPacing();
+					RestartClockRate();
+				}
+
+				else if (mRunning && mTargetClock != UNTHROTTLED)
+				{
+					Govern(wakeups);
+				}
+
+				continue;
+			}
+
+			if (executed)
+			{
+				Publish();
+				lastPublish = Clock::now();
+			}
+
+			mWakeups.wait(wakeups, std::memory_order_acquire);
+		}
+	}
+
+	void EmulationThread::Execute(Command& command)
+	{
+		switch (command.Type)
+		{
+
+		case CommandType::Step:
+			if (command.Value == 0)
+			{
+				break;
+			}
+
+			mRunning = true;
+			mStepsLeft = command.Value;
+			mError.clear();
+			RestartPacing();
+			RestartClockRate();
+			break;
+
+		case CommandType::Run:
+			mRunning = true;
+			mStepsLeft = 0;
+			mError.clear();
+			RestartPacing();
+			RestartClockRate();
+			break;
+
+		case CommandType::Pause:
+			mRunning = false;
+			mStepsLeft = 0;
+			break;
+
+		case CommandType::SetSpeed:
+			mTargetClock = command.Value;
+			RestartPacing();
+			RestartClockRate();
+			break;
+
+		case CommandType::RecordAccesses:
+			if (command.Value && !mRecordingAccesses)
+			{
+				mAccesses.Reset(mBus->GetSize());
+				mBus->RegisterObserver(&mAccesses);
+			}
+
+			else if (!command.Value && mRecordingAccesses)
+			{
+				mBus->UnregisterObserver(&mAccesses);
+			}
+
+			mRecordingAccesses = (command.Value != 0);
+			break;
+
+		case CommandType::RecordExecution:
+			mTracing = (command.Value != 0);
+
+			if (mTracing)
+			{
+				mExecutionTrace.Reset();
+			}
+
+			mCpu->AttachExecutionTrace(mTracing ? &mExecutionTrace : nullptr);
+			break;
+
+		case CommandType::RecordHeat:
+			if (command.Value && !mHeatMapping)
+			{
+				mBus->RegisterObserver(&mHeatMap);
+			}
+
+			else if (!command.Value && mHeatMapping)
+			{
+				mBus->UnregisterObserver(&mHeatMap);
+			}
+
+			mHeatMapping = (command.Value != 0);
+			mCpu->AttachHeatMap(mHeatMapping ? &mHeatMap : nullptr);
+			break;
+
+		case CommandType::SetBreakpoint:
+			mCpu->SetBreakpoint(command.Value, true);
+			break;
+
+		case CommandType::ClearBreakpoint:
+			mCpu->SetBreakpoint(command.Value, false);
+			break;
+
+		case CommandType::Invoke:
+			try
+			{
+				if (command.Function)
+				{
+					command.Function();
+				}
+			}
+
+			catch (const std::runtime_error& e)
+			{
+				mError = e.what();
+			}
+			break;
+		}
+
+		command.Function = nullptr;
+	}
+
+	void EmulationThread::RunSlice()
+	{
+		// a paced slice ends on its cycle budget, an unthrottled one on its instruction count
+		const u64 cycleLimit = (mTargetClock != UNTHROTTLED)
+			? mCpu->GetCycleCount() + std::max<u64>(1, static_cast<u64>(mTargetClock * GOVERNOR_SLICE))
+			: std::numeric_limits<u64>::max();
+
+		const bool stepping = (mStepsLeft > 0);
+		u32 instructions = stepping ? std::min(mStepsLeft, RUN_SLICE) : RUN_SLICE;
+
+		try
+		{
+			while (instructions > 0 && mCpu->GetCycleCount() < cycleLimit)
+			{
+				const u8 executed = mCpu->Cycles(static_cast<u8>(std::min<u32>(instructions, BATCH)));
+
+				instructions -= executed;
+
+				if (stepping)
+				{
+					mStepsLeft -= executed;
+				}
+
+				if (mCpu->IsAtBreakpoint())
+				{
+					mRunning = false;
+					mStepsLeft = 0;
+					return;
+				}
+			}
+		}
+
+		catch (const std::runtime_error& e)
+		{
+			// a fault in the guest (e.g. an access to unmapped memory) stops it, not the thread
+			mError = e.what();
+			mRunning = false;
+			mStepsLeft = 0;
+			return;
+		}
+
+		if (stepping && mStepsLeft == 0)
+		{
+			mRunning = false;
+		}
+	}
+
+	void EmulationThread::Govern(u32 wakeups)
+	{
+		const double emulatedSeconds = static_cast<double>(mCpu->GetCycleCount() - mPaceCycles) / mTargetClock;
+		const auto deadline = mPaceStart + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(emulatedSeconds));
+
+		auto now = Clock::now();
+
+		if (std::chrono::duration<double>(now - deadline).count() > MAX_LAG)
+		{
+			RestartPacing();
+			return;
+		}
+
+		// sleep in short pieces, a command posted meanwhile is picked up without waiting the budget out
+		while (now < deadline && mWakeups.load(std::memory_order_acquire) == wakeups && !mStop)
+		{
+			std::this_thread::sleep_for(std::min<Clock::duration>(deadline - now, std::chrono::milliseconds(1)));
+			now = Clock::now();
+		}
+	}
+
+	void EmulationThread::RestartPacing()
+	{
+		mPaceStart = Clock::now();
+		mPaceCycles = mCpu->GetCycleCount();
+	}
+
+	void EmulationThread::RestartClockRate()
+	{
+		mRateStart = Clock::now();
+		mRateCycles = mCpu->GetCycleCount();
+		mClockRate = 0.0;
+	}
+
+	void EmulationThread::UpdateClockRate(Clock::time_point now)
+	{
+		const double seconds = std::chrono::duration<double>(now - mRateStart).count();
+
+		if (seconds >= RATE_WINDOW)
+		{
+			mClockRate = static_cast<double>(mCpu->GetCycleCount() - mRateCycles) / seconds;
+			mRateStart = now;
+			mRateCycles = mCpu->GetCycleCount();
+		}
+	}
+
+	void EmulationThread::Publish()
+	{
+		EmulatorSnapshot& snapshot = mSnapshots.GetWriteBuffer();
+
+		mCpu->GetInternalState(snapshot.State);
+		snapshot.Cycles = mCpu->GetCycleCount();
+		snapshot.Instructions = mCpu->GetInstructionCount();
+		snapshot.BusReads = mBus->GetReadCount();
+		snapshot.BusWrites = mBus->GetWriteCount();
+		snapshot.BusySeconds = mBusySeconds;
+		snapshot.Sequence = ++mSequence;
+		snapshot.Running = mRunning;
+		snapshot.Halted = mCpu->IsHalted();
+		snapshot.AtBreakpoint = mCpu->IsAtBreakpoint();
+		snapshot.TargetClock = mTargetClock;
+		snapshot.ClockRate = mRunning ? mClockRate : 0.0;
+		snapshot.Error = mError;
+		snapshot.Memory.Update(*mBus);
+
+		// what the last snapshot the UI took held has been seen, the rest rides along until taken
+		const bool previousTaken = mSnapshots.IsTaken();
+
+		if (previousTaken)
+		{
+			mUnseenTextRows = 0;
+		}
+
+		mUnseenTextRows |= mTextModeAdapter ? mTextModeAdapter->ConsumeDirtyRows() : 0;
+		snapshot.TextRowsChanged = mUnseenTextRows;
+
+		if (mRecordingAccesses)
+		{
+			mAccesses.Collect(snapshot.Reads, snapshot.Writes, previousTaken);
+		}
+
+		else
+		{
+			snapshot.Reads.clear();
+			snapshot.Writes.clear();
+		}
+
+		// a whole trace is too large to copy at every publish, it is looked at while stopped anyway
+		if (!mRunning)
+		{
+			mExecutionTrace.CopyTo(snapshot.Trace);
+		}
+
+		else
+		{
+			snapshot.Trace.clear();
+		}
+
+		snapshot.TraceRecorded = mExecutionTrace.GetRecordedCount();
+		snapshot.Tracing = mTracing;
+
+		if (mHeatMapping)
+		{
+			const auto counts = mHeatMap.GetCounts();
+			snapshot.Heat.assign(counts.begin(), counts.end());
+		}
+
+		snapshot.HeatMapping = mHeatMapping;
+
+		mSnapshots.Publish();
+
+		if (mPublishListener)
+		{
+			mPublishListener();
+		}
+	}
+
+} // namespace i8086
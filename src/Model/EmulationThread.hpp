@@ -0,0 +1,264 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "AccessRecorder.hpp"
+#include "CPUState.hpp"
+#include "ExecutionTrace.hpp"
+#include "I8086.hpp"
+#include "MemoryHeatMap.hpp"
+#include "MemoryBus.hpp"
+#include "MemorySnapshot.hpp"
+#include "TextModeAdapter.hpp"
+
+#include <Interfaces/IMemorySource.hpp>
+#include <Utils/SpscQueue.hpp>
+#include <Utils/TripleBuffer.hpp>
+#include <Utils/types.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace i8086
+{
+
+	/**
+	 * @brief What the UI sees of the machine, published by the emulation thread.
+	 */
+	struct EmulatorSnapshot
+	{
+		CPUState State{};
+		u64 Cycles{ 0 };
+		u64 Instructions{ 0 };
+		u64 BusReads{ 0 };
+		u64 BusWrites{ 0 };
+		double BusySeconds{ 0.0 };  // host time spent executing instructions since Start
+		u64 Sequence{ 0 };        // bumped by every publish
+		bool Running{ false };
+		bool Halted{ false };
+		bool AtBreakpoint{ false };
+		u32 TargetClock{ 0 };     // Hz the run is paced to, 0 when unthrottled
+		double ClockRate{ 0.0 };  // emulated Hz actually reached, 0 while paused
+		u32 TextRowsChanged{ 0 }; // text-mode rows written since the previous snapshot the UI took (bit n = row n)
+		std::vector<AccessRange> Reads;  // memory the CPU accessed since then, while access recording is on
+		std::vector<AccessRange> Writes;
+		std::vector<ExecutionTraceEntry> Trace; // oldest first, only filled while the machine is stopped
+		u64 TraceRecorded{ 0 };                 // instructions traced since recording was turned on
+		bool Tracing{ false };
+		std::vector<u32> Heat;                  // MemoryHeatMap counts so far, while heat mapping is on
+		bool HeatMapping{ false };
+		std::string Error;        // why the last run stopped, if it failed
+		MemorySnapshot Memory;
+	};
+
+	/**
+	 * @brief Runs the CPU, its buses and devices on a thread of their own.
+	 *
+	 * @details
+	 * The machine belongs to the emulation thread once Start is called. The UI talks to it
+	 * in two directions without locks:
+	 * - commands (step, run, pause, speed, breakpoints, or any function to run on the machine)
+	 *   go through a single-producer single-consumer queue;
+	 * - the CPU state and a copy of memory come back through a triple buffer, published
+	 *   after every command and at most every PUBLISH_INTERVAL while running.
+	 *
+	 * Neither side ever waits for the other, an idle emulation thread sleeps until the next
+	 * command is posted.
+	 *
+	 * Runs are paced to a target clock: the CPU gets a budget of GOVERNOR_SLICE worth of cycles,
+	 * then the thread sleeps until the host time those cycles stand for. Deadlines are taken
+	 * from the start of the run, so sleep granularity does not add up; a host that falls more
+	 * than MAX_LAG behind starts counting again from where it is instead of racing to catch up.
+	 * Unthrottled runs skip the pacing and report the clock they reach.
+	 */
+	class EmulationThread
+	{
+
+	public:
+
+		enum class CommandType : u8
+		{
+			Step,
+			Run,
+			Pause,
+			SetSpeed,
+			RecordAccesses,
+			RecordExecution,
+			RecordHeat,
+			SetBreakpoint,
+			ClearBreakpoint,
+			Invoke
+		};
+
+		struct Command
+		{
+			CommandType Type{ CommandType::Pause };
+			u32 Value{ 0 };                   // instruction count, clock in Hz or breakpoint address
+			std::function<void()> Function{}; // for Invoke, runs on the emulation thread
+		};
+
+		static constexpr u32 CLOCK_PC_XT = 4'772'727; // 14.31818 MHz crystal divided by 3
+		static constexpr u32 CLOCK_8MHZ  = 8'000'000;
+		static constexpr u32 UNTHROTTLED = 0;
+
+		static constexpr u32 RUN_SLICE = 4096;       // instructions run between command checks
+		static constexpr u8 BATCH = 64;              // instructions per I8086::Cycles call
+		static constexpr double GOVERNOR_SLICE = 0.001;
+		static constexpr double MAX_LAG = 0.05;
+		static constexpr double RATE_WINDOW = 0.5;   // seconds the reached clock is averaged over
+		static constexpr double PUBLISH_INTERVAL = 1.0 / 120.0;
+
+		EmulationThread(I8086* cpu, MemoryBus* bus, TextModeAdapter* textModeAdapter = nullptr);
+		~EmulationThread();
+
+		EmulationThread(const EmulationThread&) = delete;
+		EmulationThread& operator=(const EmulationThread&) = delete;
+
+		/**
+		 * @brief Called on the emulation thread after each publish, e.g. to wake an idle UI. Set it before Start.
+		 */
+		void SetPublishListener(std::function<void()> listener) { mPublishListener = std::move(listener); }
+
+		void Start();
+		void Stop();
+
+		/* UI thread */
+
+		/**
+		 * @brief Queues a command, returns false if the queue is full.
+		 */
+		bool Post(Command command);
+
+		/**
+		 * @brief Runs count instructions at the current speed, then pauses. Breakpoints and Pause stop it early.
+		 */
+		bool Step(u32 count = 1) { return Post({ CommandType::Step, count }); }
+		bool Run() { return Post({ CommandType::Run }); }
+		bool Pause() { return Post({ CommandType::Pause }); }
+
+		/**
+		 * @param clock Emulated cycles per host second, UNTHROTTLED to run as fast as the host can.
+		 */
+		bool SetSpeed(u32 clock) { return Post({ CommandType::SetSpeed, clock }); }
+
+		/**
+		 * @brief Turns on the memory access ranges of the snapshots, which cost the CPU an observer call per access.
+		 */
+		bool RecordAccesses(bool state) { return Post({ CommandType::RecordAccesses, state ? 1u : 0u }); }
+
+		/**
+		 * @brief Starts a new execution trace of the last ExecutionTrace::DEFAULT_CAPACITY instructions, or stops it.
+		 */
+		bool RecordExecution(bool state) { return Post({ CommandType::RecordExecution, state ? 1u : 0u }); }
+
+		/**
+		 * @brief Turns on the memory heat map of the snapshots, counting on from where it was left.
+		 */
+		bool RecordHeat(bool state) { return Post({ CommandType::RecordHeat, state ? 1u : 0u }); }
+
+		bool SetBreakpoint(u32 address, bool state)
+		{
+			return Post({ state ? CommandType::SetBreakpoint : CommandType::ClearBreakpoint, address });
+		}
+
+		/**
+		 * @brief Runs function on the emulation thread between instructions, for anything touching the machine.
+		 */
+		bool Invoke(std::function<void()> function) { return Post({ CommandType::Invoke, 0, std::move(function) }); }
+
+		/**
+		 * @brief Takes the latest published snapshot, meant to be called once per frame.
+		 *
+		 * @return true if it is newer than the previous one.
+		 */
+		bool AcquireSnapshot() { return mSnapshots.Acquire(); }
+
+		/**
+		 * @brief The snapshot taken by the last AcquireSnapshot.
+		 */
+		const EmulatorSnapshot& GetSnapshot() const { return mSnapshots.GetReadBuffer(); }
+
+		/**
+		 * @brief Memory of the current snapshot, a stable object for views and caches.
+		 */
+		const IMemorySource* GetMemory() const { return &mMemoryView; }
+
+	private:
+
+		class SnapshotMemoryView : public IMemorySource
+		{
+
+		public:
+
+			SnapshotMemoryView(const EmulationThread* owner) : mOwner(owner) {}
+
+			void ReadBlock(u32 physicalAddress, std::span<u8> buffer) const override
+			{
+				mOwner->GetSnapshot().Memory.ReadBlock(physicalAddress, buffer);
+			}
+
+			size_t GetSize() const override { return mOwner->GetSnapshot().Memory.GetSize(); }
+			u32 GetPageVersion(u32 page) const override { return mOwner->GetSnapshot().Memory.GetPageVersion(page); }
+
+		private:
+
+			const EmulationThread* const mOwner;
+		};
+
+		using Clock = std::chrono::steady_clock;
+
+		void Worker();
+		void Execute(Command& command);
+		void RunSlice();
+		void Govern(u32 wakeups);
+		void RestartPacing();
+		void RestartClockRate();
+		void UpdateClockRate(Clock::time_point now);
+		void Publish();
+
+	private:
+
+		I8086* const mCpu;
+		MemoryBus* const mBus;
+		TextModeAdapter* const mTextModeAdapter;
+
+		std::thread mThread;
+		std::atomic<bool> mStop{ false };
+		std::atomic<u32> mWakeups{ 0 };
+
+		SpscQueue<Command, 256> mCommands;
+		TripleBuffer<EmulatorSnapshot> mSnapshots;
+		SnapshotMemoryView mMemoryView{ this };
+		std::function<void()> mPublishListener;
+
+		/* emulation thread only */
+
+		bool mRunning{ false };
+		u32 mStepsLeft{ 0 };      // instructions the current step still runs, 0 for a plain run
+		u32 mTargetClock{ CLOCK_PC_XT };
+
+		Clock::time_point mPaceStart;
+		u64 mPaceCycles{ 0 };
+		Clock::time_point mRateStart;
+		u64 mRateCycles{ 0 };
+		double mClockRate{ 0.0 };
+		double mBusySeconds{ 0.0 };
+
+		u64 mSequence{ 0 };
+		u32 mUnseenTextRows{ 0 };
+		AccessRecorder mAccesses;
+		bool mRecordingAccesses{ false };
+		ExecutionTrace mExecutionTrace;
+		bool mTracing{ false };
+		MemoryHeatMap mHeatMap;
+		bool mHeatMapping{ false };
+		std::string mError;
+	};
+
+} // namespace i8086
@@ -0,0 +1,54 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "ExecutionTrace.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace i8086
+{
+
+	ExecutionTrace::ExecutionTrace(size_t capacity)
+	{
+		mEntries.resize(std::bit_ceil(std::max<size_t>(capacity, 1)));
+		mMask = mEntries.size() - 1;
+	}
+
+	void ExecutionTrace::Reset()
+	{
+		mHead = 0;
+		mRecorded = 0;
+	}
+
+	void ExecutionTrace::CopyTo(std::vector<ExecutionTraceEntry>& out) const
+	{
+		const size_t size = GetSize();
+
+		out.resize(size);
+
+		// the oldest entry is the head once the ring has wrapped, the first one before
+		const size_t first = (size == mEntries.size()) ? mHead : 0;
+		const size_t untilEnd = std::min(size, mEntries.size() - first);
+
+		std::copy_n(mEntries.begin() + first, untilEnd, out.begin());
+		std::copy_n(mEntries.begin(), size - untilEnd, out.begin() + untilEnd);
+	}
+
+	u16 ExecutionTrace::GetChangedRegisters(const ExecutionTraceEntry& before, const ExecutionTraceEntry& after)
+	{
+		u16 changed = (before.Flags != after.Flags) ? FLAGS_CHANGED : 0;
+
+		for (size_t i = 0; i < ExecutionTraceEntry::REGISTER_COUNT; ++i)
+		{
+			if (before.Registers[i] != after.Registers[i])
+			{
+				changed |= static_cast<u16>(1u << i);
+			}
+		}
+
+		return changed;
+	}
+
+} // namespace i8086
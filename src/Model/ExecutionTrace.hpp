@@ -0,0 +1,104 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace i8086
+{
+
+	/**
+	 * @brief One executed instruction: where it was, its bytes and the registers it left behind.
+	 *
+	 * @details
+	 * What an instruction changed is the difference with the entry before it, see GetChangedRegisters.
+	 */
+	struct ExecutionTraceEntry
+	{
+		static constexpr u8 MAX_BYTES = 6;
+		static constexpr size_t REGISTER_COUNT = 12;
+
+		u16 CS{};
+		u16 IP{};
+		std::array<u8, MAX_BYTES> Bytes{};
+		u8 Length{};
+		u16 Flags{};
+		std::array<u16, REGISTER_COUNT> Registers{}; // after the instruction, in REGISTER_NAMES order
+
+		u32 GetAddress() const { return (static_cast<u32>(CS) << 4) + IP; }
+	};
+
+	/**
+	 * @brief Ring buffer of the last executed instructions.
+	 *
+	 * @details
+	 * The CPU writes entries in place while one is attached (I8086::AttachExecutionTrace): a
+	 * few dozen bytes of stores per instruction, cheap enough to leave on. Once full, the
+	 * oldest entries are overwritten.
+	 */
+	class ExecutionTrace
+	{
+
+	public:
+
+		static constexpr size_t DEFAULT_CAPACITY = 1u << 16;
+
+		static constexpr std::array<const char*, ExecutionTraceEntry::REGISTER_COUNT> REGISTER_NAMES = {
+			"AX", "BX", "CX", "DX", "SP", "BP", "SI", "DI", "CS", "DS", "SS", "ES"
+		};
+
+		static constexpr u16 FLAGS_CHANGED = 1u << ExecutionTraceEntry::REGISTER_COUNT;
+
+		/**
+		 * @param capacity Rounded up to a power of two.
+		 */
+		ExecutionTrace(size_t capacity = DEFAULT_CAPACITY);
+
+		/**
+		 * @brief The entry to fill for the instruction just executed.
+		 */
+		ExecutionTraceEntry& Next()
+		{
+			ExecutionTraceEntry& entry = mEntries[mHead];
+
+			mHead = (mHead + 1) & mMask;
+			++mRecorded;
+
+			return entry;
+		}
+
+		void Reset();
+
+		size_t GetCapacity() const { return mEntries.size(); }
+		size_t GetSize() const { return (mRecorded < mEntries.size()) ? static_cast<size_t>(mRecorded) : mEntries.size(); }
+
+		/**
+		 * @brief Entries recorded since the last Reset, including the overwritten ones.
+		 */
+		u64 GetRecordedCount() const { return mRecorded; }
+
+		/**
+		 * @brief Copies the entries in execution order, oldest first.
+		 */
+		void CopyTo(std::vector<ExecutionTraceEntry>& out) const;
+
+		/**
+		 * @brief Bit n set if register n differs between the two entries, FLAGS_CHANGED if the flags do.
+		 */
+		static u16 GetChangedRegisters(const ExecutionTraceEntry& before, const ExecutionTraceEntry& after);
+
+	private:
+
+		std::vector<ExecutionTraceEntry> mEntries;
+		size_t mMask{ 0 };
+		size_t mHead{ 0 };
+		u64 mRecorded{ 0 };
+	};
+
+} // namespace i8086
@@ -0,0 +1,329 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "FlowAnalyzer.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace disassembler
+{
+
+	void FlowAnalyzer::AddEntryPoint(u16 segment, u16 offset)
+	{
+		mEntryPoints.push_back({ segment, offset });
+	}
+
+	void FlowAnalyzer::ClearEntryPoints()
+	{
+		mEntryPoints.clear();
+		mUseInterruptVectors = false;
+	}
+
+	void FlowAnalyzer::Analyze(std::span<const u8> code, u32 baseAddress)
+	{
+		const auto begin = std::chrono::steady_clock::now();
+
+		mCode = code;
+		mBaseAddress = baseAddress;
+		mDecoder.SetSource(code, baseAddress);
+
+		mInstructionInfo.assign(code.size(), 0);
+		mLeaders.Clear();
+		mLeaders.Reserve(code.size() / 16);
+		mInstructionCount = 0;
+
+		mWorklist.clear();
+		mBranches.clear();
+		mUnresolved.clear();
+
+		for (const auto& entry : mEntryPoints)
+		{
+			Queue(entry, true);
+		}
+
+		if (mUseInterruptVectors && Contains(0x0000) && Contains(0x03FF))
+		{
+			auto read16 = [this](u32 address) -> u16
+			{
+				const u32 offset = address - mBaseAddress;
+				return static_cast<u16>(mCode[offset] | (mCode[offset + 1] << 8));
+			};
+
+			for (u32 vector = 0; vector < 256; ++vector)
+			{
+				const CodeAddress handler{ read16(vector * 4 + 2), read16(vector * 4) };
+
+				if (handler.Segment != 0 || handler.Offset != 0)
+				{
+					Queue(handler, true);
+				}
+			}
+		}
+
+		while (!mWorklist.empty())
+		{
+			const CodeAddress start = mWorklist.back();
+			mWorklist.pop_back();
+
+			Trace(start);
+		}
+
+		BuildBlocks();
+		BuildReferences();
+
+		mLastDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	void FlowAnalyzer::Queue(CodeAddress target, bool isCallTarget)
+	{
+		const u32 address = target.Physical();
+
+		if (!Contains(address))
+		{
+			return;
+		}
+
+		if (Leader* leader = mLeaders.Find(address))
+		{
+			leader->IsCallTarget |= isCallTarget;
+		}
+
+		else
+		{
+			mLeaders[address] = { target.Segment, isCallTarget };
+		}
+
+		if (mInstructionInfo[address - mBaseAddress] == 0)
+		{
+			mWorklist.push_back(target);
+		}
+	}
+
+	void FlowAnalyzer::Trace(CodeAddress start)
+	{
+		CodeAddress at = start;
+
+		while (true)
+		{
+			const u32 address = at.Physical();
+
+			if (!Contains(address))
+			{
+				return;
+			}
+
+			u8& flags = mInstructionInfo[address - mBaseAddress];
+
+			if (flags != 0)
+			{
+				// flowed into code decoded from another path, a block has to start here
+				if (address != start.Physical() && !mLeaders.Contains(address))
+				{
+					mLeaders[address] = { at.Segment, false };
+				}
+
+				return;
+			}
+
+			const Instruction instr = mDecoder.DecodeAt(address);
+			const i8086::OpcodeInfo& info = i8086::GetOpcodeInfo(instr.Bytes[0], (instr.ModRM >> 3) & 0x07);
+
+			const CodeAddress next{ at.Segment, static_cast<u16>(at.Offset + instr.Length) };
+
+			flags = instr.Length;
+			++mInstructionCount;
+
+			switch (info.Branch)
+			{
+
+			case i8086::ConditionalJump:
+				AddBranch(instr, next, FlowKind::ConditionalJump);
+				flags |= ENDS_BLOCK;
+				Queue(next);
+				break;
+
+			case i8086::Call:
+				AddBranch(instr, next, FlowKind::Call);
+				flags |= ENDS_BLOCK;
+				Queue(next);
+				break;
+
+			case i8086::Jump:
+				AddBranch(instr, next, FlowKind::Jump);
+				flags |= ENDS_BLOCK | NO_FALLTHROUGH;
+				break;
+
+			case i8086::Return:
+			case i8086::InterruptReturn:
+			case i8086::Halt:
+				flags |= ENDS_BLOCK | NO_FALLTHROUGH;
+				break;
+
+			default:
+				break;
+			}
+
+			if (flags & ENDS_BLOCK)
+			{
+				// the fall-through, if any, was queued as a block of its own
+				return;
+			}
+
+			at = next;
+		}
+	}
+
+	void FlowAnalyzer::AddBranch(const Instruction& instr, CodeAddress next, FlowKind kind)
+	{
+		const Operand& operand = instr.Operands[0];
+		CodeAddress target{};
+
+		switch (operand.Type)
+		{
+
+		case rel8:
+			target = { next.Segment, static_cast<u16>(next.Offset + static_cast<s8>(operand.Value)) };
+			break;
+
+		case rel16:
+			target = { next.Segment, static_cast<u16>(next.Offset + operand.Value) };
+			break;
+
+		case segAddr:
+			target = { operand.Segment, operand.Value };
+			break;
+
+		default:
+			// through a register or memory, the target is only known at run time
+			mUnresolved.push_back(instr.Address);
+			return;
+		}
+
+		mBranches.push_back({ instr.Address, target.Physical(), kind });
+
+		Queue(target, kind == FlowKind::Call);
+	}
+
+	void FlowAnalyzer::BuildBlocks()
+	{
+		std::sort(mBranches.begin(), mBranches.end(), [](const FlowEdge& a, const FlowEdge& b) { return a.From < b.From; });
+
+		std::vector<u32> leaders;
+		leaders.reserve(mLeaders.Size());
+
+		mLeaders.ForEach([&leaders](u32 address, const Leader&) { leaders.push_back(address); });
+		std::sort(leaders.begin(), leaders.end());
+
+		mBlocks.clear();
+		mSuccessors.clear();
+
+		for (const u32 start : leaders)
+		{
+			if (!IsInstructionStart(start))
+			{
+				continue;
+			}
+
+			const Leader& leader = *mLeaders.Find(start);
+
+			BasicBlock block{};
+			block.Start = start;
+			block.Segment = leader.Segment;
+			block.IsCallTarget = leader.IsCallTarget;
+
+			u32 address = start;
+			u8 flags = 0;
+
+			while (true)
+			{
+				flags = mInstructionInfo[address - mBaseAddress];
+
+				block.LastInstruction = address;
+				++block.InstructionCount;
+
+				address += flags & LENGTH_MASK;
+
+				if ((flags & ENDS_BLOCK) || !IsInstructionStart(address) || mLeaders.Contains(address))
+				{
+					break;
+				}
+			}
+
+			block.End = address;
+			block.FirstSuccessor = static_cast<u32>(mSuccessors.size());
+
+			const auto branches = std::equal_range(mBranches.begin(), mBranches.end(), FlowEdge{ block.LastInstruction },
+				[](const FlowEdge& a, const FlowEdge& b) { return a.From < b.From; });
+
+			mSuccessors.insert(mSuccessors.end(), branches.first, branches.second);
+
+			if (!(flags & NO_FALLTHROUGH) && IsInstructionStart(address))
+			{
+				mSuccessors.push_back({ block.LastInstruction, address, FlowKind::FallThrough });
+			}
+
+			block.SuccessorCount = static_cast<u16>(mSuccessors.size() - block.FirstSuccessor);
+
+			mBlocks.push_back(block);
+		}
+	}
+
+	void FlowAnalyzer::BuildReferences()
+	{
+		mReferences = mBranches;
+
+		std::sort(mReferences.begin(), mReferences.end(), [](const FlowEdge& a, const FlowEdge& b) {
+			return (a.To != b.To) ? a.To < b.To : a.From < b.From;
+		});
+
+		mReferenceIndex.Clear();
+
+		for (u32 first = 0; first < mReferences.size();)
+		{
+			u32 last = first;
+
+			while (last < mReferences.size() && mReferences[last].To == mReferences[first].To)
+			{
+				++last;
+			}
+
+			mReferenceIndex[mReferences[first].To] = { first, last - first };
+
+			first = last;
+		}
+	}
+
+	const BasicBlock* FlowAnalyzer::FindBlock(u32 address) const
+	{
+		auto it = std::upper_bound(mBlocks.begin(), mBlocks.end(), address, [](u32 value, const BasicBlock& block) { return value < block.Start; });
+
+		if (it == mBlocks.begin())
+		{
+			return nullptr;
+		}
+
+		--it;
+
+		return (address < it->End) ? &*it : nullptr;
+	}
+
+	std::span<const FlowEdge> FlowAnalyzer::GetReferencesTo(u32 address) const
+	{
+		const ReferenceRange* range = mReferenceIndex.Find(address);
+
+		if (!range)
+		{
+			return {};
+		}
+
+		return { mReferences.data() + range->First, range->Count };
+	}
+
+	bool FlowAnalyzer::IsInstructionStart(u32 address) const
+	{
+		return Contains(address) && mInstructionInfo[address - mBaseAddress] != 0;
+	}
+
+} // namespace disassembler
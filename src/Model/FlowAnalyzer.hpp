@@ -0,0 +1,172 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "Disassembler.hpp"
+
+#include <Utils/FlatHashMap.hpp>
+#include <Utils/types.hpp>
+
+#include <span>
+#include <vector>
+
+namespace disassembler
+{
+
+	enum class FlowKind : u8
+	{
+		FallThrough,
+		Jump,
+		ConditionalJump,
+		Call
+	};
+
+	/**
+	 * @brief Transfer of control from the instruction at From to the address To.
+	 */
+	struct FlowEdge
+	{
+		u32 From{};
+		u32 To{};
+		FlowKind Kind{ FlowKind::FallThrough };
+	};
+
+	/**
+	 * @brief Straight-line run of instructions, entered only at Start and left only after its last one.
+	 */
+	struct BasicBlock
+	{
+		u32 Start{};
+		u32 End{};          // address after the last instruction
+		u32 LastInstruction{};
+		u32 InstructionCount{};
+		u16 Segment{};      // CS the block was reached with, near branches stay in it
+		bool IsCallTarget{ false };
+
+		u32 FirstSuccessor{};
+		u16 SuccessorCount{};
+	};
+
+	/**
+	 * @brief Recursive traversal disassembly: basic blocks, control flow graph and cross-references.
+	 *
+	 * @details
+	 * Unlike the linear sweep of Disassembler::Disassembly, only bytes reached from an entry
+	 * point by following fall-throughs, jumps and calls are decoded, so data between code is
+	 * left alone. Reached addresses go through a worklist; instruction starts are kept in a
+	 * dense per-byte table and block leaders and references in flat hash maps.
+	 *
+	 * Indirect jumps and calls (through a register or memory) cannot be followed statically,
+	 * their addresses are listed by GetUnresolved.
+	 */
+	class FlowAnalyzer
+	{
+
+	public:
+
+		void AddEntryPoint(u16 segment, u16 offset);
+
+		/**
+		 * @brief Adds F000:FFF0, where the 8086 starts after reset.
+		 */
+		void AddResetVector() { AddEntryPoint(0xF000, 0xFFF0); }
+
+		/**
+		 * @brief Adds every non-null vector of the IVT, read from the analysed code when it covers 0-3FF.
+		 */
+		void AddInterruptVectors() { mUseInterruptVectors = true; }
+
+		void ClearEntryPoints();
+
+		/**
+		 * @brief Analyses code loaded at baseAddress from the entry points added so far.
+		 */
+		void Analyze(std::span<const u8> code, u32 baseAddress);
+
+		std::span<const BasicBlock> GetBlocks() const { return mBlocks; }
+
+		/**
+		 * @brief Block containing the instruction at address, nullptr if it was not reached.
+		 */
+		const BasicBlock* FindBlock(u32 address) const;
+
+		std::span<const FlowEdge> GetSuccessors(const BasicBlock& block) const
+		{
+			return { mSuccessors.data() + block.FirstSuccessor, block.SuccessorCount };
+		}
+
+		/**
+		 * @brief Jumps and calls whose target is address (its callers are the Call ones).
+		 */
+		std::span<const FlowEdge> GetReferencesTo(u32 address) const;
+
+		std::span<const u32> GetUnresolved() const { return mUnresolved; }
+
+		bool IsInstructionStart(u32 address) const;
+		size_t GetInstructionCount() const { return mInstructionCount; }
+
+		double GetLastDuration() const { return mLastDuration; }
+
+	private:
+
+		struct CodeAddress
+		{
+			u16 Segment{};
+			u16 Offset{};
+
+			u32 Physical() const { return (static_cast<u32>(Segment) << 4) + Offset; }
+		};
+
+		struct Leader
+		{
+			u16 Segment{};
+			bool IsCallTarget{ false };
+		};
+
+		struct ReferenceRange
+		{
+			u32 First{};
+			u32 Count{};
+		};
+
+		bool Contains(u32 address) const { return address - mBaseAddress < mCode.size(); }
+
+		void Queue(CodeAddress target, bool isCallTarget = false);
+		void Trace(CodeAddress start);
+		void AddBranch(const Instruction& instr, CodeAddress next, FlowKind kind);
+		void BuildBlocks();
+		void BuildReferences();
+
+	private:
+
+		static constexpr u8 LENGTH_MASK    = 0x0F;
+		static constexpr u8 ENDS_BLOCK     = 0x40; // last instruction of a block (any branch)
+		static constexpr u8 NO_FALLTHROUGH = 0x80; // control never reaches the next instruction
+
+		Disassembler mDecoder;
+		std::span<const u8> mCode;
+		u32 mBaseAddress{ 0 };
+
+		std::vector<CodeAddress> mEntryPoints;
+		bool mUseInterruptVectors{ false };
+
+		std::vector<CodeAddress> mWorklist;
+		std::vector<u8> mInstructionInfo; // per byte of code, 0 if no instruction starts there
+		FlatHashMap<Leader> mLeaders;
+		size_t mInstructionCount{ 0 };
+
+		std::vector<FlowEdge> mBranches;
+		std::vector<u32> mUnresolved;
+
+		std::vector<BasicBlock> mBlocks;
+		std::vector<FlowEdge> mSuccessors;
+
+		std::vector<FlowEdge> mReferences; // branches sorted by target
+		FlatHashMap<ReferenceRange> mReferenceIndex;
+
+		double mLastDuration{ 0.0 };
+	};
+
+} // namespace disassembler
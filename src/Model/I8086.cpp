@@ -4,9 +4,11 @@
 
 #include "I8086.hpp"
 #include "Instructions.hpp"
+#include "OpcodeTable.hpp"
 
 #include <fstream>
 #include <algorithm>
+#include <stdexcept>
 
 namespace i8086
 {
@@ -14,8 +16,14 @@ namespace i8086
 	constexpr u8 WORD = 16;
 	constexpr u8 BYTE = 8;
 
-	I8086::I8086(MemoryBus* const bus) : mBus(bus)
+	I8086::I8086(MemoryBus* const bus, IO::IOBus* const ioBus, Scheduler* const scheduler)
+		: mBus(bus), mIOBus(ioBus), mScheduler(scheduler)
 	{
+		if (!mScheduler)
+		{
+			throw std::runtime_error("I8086::I8086 -> Scheduler is not initialized");
+		}
+
 		SP = 0xFFFE;
 
 		using I86 = I8086;
@@ -317,14 +325,29 @@ namespace i8086
 
 		IP.X += size / 8;
 
+		// both bytes are stored either way, the buffer has room for one past the last counted
+		if (mExecutionTrace && mFetchedCount < ExecutionTraceEntry::MAX_BYTES)
+		{
+			mFetchedBytes[mFetchedCount] = static_cast<u8>(fetchedData);
+			mFetchedBytes[mFetchedCount + 1] = static_cast<u8>(fetchedData >> 8);
+			mFetchedCount += size / 8;
+		}
+
 		return fetchedData;
 	}
 
-	void I8086::Cycles(u8 count)
+	u8 I8086::Cycles(u8 count)
 	{
+		u8 executed = count;
+
+		if (mHalted)
+		{
+			FastForwardHalt();
+		}
+
 		if (!mHalted)
 		{
-			ExecuteInstructions(count);
+			executed = ExecuteInstructions(count);
 		}
 
 		if (mPendingInterruptFlag)
@@ -332,12 +355,16 @@ namespace i8086
 			SF.I = true;
 			mPendingInterruptFlag = false;
 		}
+
+		return executed;
 	}
 
 	void I8086::FetchModrm()
 	{
 		const u8 modrmByte = Fetch();
 
+		mFetchedModrm = true;
+
 		Mod = (modrmByte & 0xC0) >> 6;
 		Reg = (modrmByte & 0x38) >> 3;
 		Rm  =  modrmByte & 0x07;
@@ -360,6 +387,8 @@ namespace i8086
 			(this->*mOpcodeTable[opcode])();
 			C.X--;
 
+			mCycles += OpcodeTable[opcode].Cycles;
+
 			if (useZStopCondition && (SF.Z == zStopCondition))
 			{
 				break;
@@ -369,26 +398,140 @@ namespace i8086
 		mREP = false;
 	}
 
-	void I8086::ExecuteInstructions(u8 count)
+	u8 I8086::ExecuteInstructions(u8 count)
 	{
 
 		u8 opcode{};
 
 		for (u8 i = 0; i < count; ++i)
 		{
+			if (mCycles >= mScheduler->GetNextEventCycle())
+			{
+				mScheduler->RunDueEvents(mCycles);
+			}
+
+			if (mPendingInterrupt && SF.I)
+			{
+				ServiceInterrupt();
+			}
+
+			if (mHalted)
+			{
+				break;
+			}
+
+			if ((mAtBreakpoint || !mBreakpoints.empty()) && StopAtBreakpoint())
+			{
+				return i;
+			}
+
+			mInstrIP = IP.X;
+			mFetchedCount = 0;
+			mFetchedModrm = false;
+
+			const u16 instrCS = CS.X;
+
+			if (mHeatMap)
+			{
+				mHeatMap->OnExecute((static_cast<u32>(instrCS) << 4) + mInstrIP);
+			}
+
 			opcode = Fetch();
 
 			OperandSize = (opcode & 1) * 8 + 8;
 
 			(this->*mOpcodeTable[opcode])();
 
+			// Reg picks the operation of a group opcode, unless its handler never fetched the ModR/M byte
+			mCycles += (mFetchedModrm ? GetOpcodeInfo(opcode, Reg) : OpcodeTable[opcode]).Cycles;
+			++mInstructions;
+
 			if (mREP)
 			{
 				HandleREP();
 			}
 
+			if (mExecutionTrace)
+			{
+				RecordExecution(instrCS);
+			}
+
+		}
+
+		return count;
+	}
+
+	void I8086::RecordExecution(u16 cs)
+	{
+		ExecutionTraceEntry& entry = mExecutionTrace->Next();
+
+		entry.CS = cs;
+		entry.IP = mInstrIP;
+		std::copy_n(mFetchedBytes.begin(), ExecutionTraceEntry::MAX_BYTES, entry.Bytes.begin());
+		entry.Length = std::min<u8>(mFetchedCount, ExecutionTraceEntry::MAX_BYTES);
+		entry.Flags = SF.Get();
+		entry.Registers = { A.X, B.X, C.X, D.X, SP.X, BP.X, SI.X, DI.X, CS.X, DS.X, SS.X, ES.X };
+	}
+
+	bool I8086::StopAtBreakpoint()
+	{
+		// the instruction a stop happened at runs once execution resumes, instead of stopping again
+		if (mAtBreakpoint)
+		{
+			mAtBreakpoint = false;
+			return false;
 		}
 
+		mAtBreakpoint = HasBreakpoint((static_cast<u32>(CS.X) << 4) + IP.X);
+
+		return mAtBreakpoint;
+	}
+
+	void I8086::FastForwardHalt()
+	{
+		// a halted CPU does nothing until an interrupt arrives, so the time in between is
+		// skipped in one step instead of being spent one cycle at a time
+		if (!SF.I)
+		{
+			// only an NMI could wake it and nothing raises one, the machine stays idle
+			return;
+		}
+
+		if (!mPendingInterrupt)
+		{
+			const u64 nextEvent = mScheduler->GetNextEventCycle();
+
+			if (nextEvent == Scheduler::NO_EVENT)
+			{
+				return;
+			}
+
+			// the skipped cycles are paced against the host clock by the EmulationThread governor
+			if (nextEvent > mCycles)
+			{
+				mCycles = nextEvent;
+			}
+
+			mScheduler->RunDueEvents(mCycles);
+		}
+
+		if (mPendingInterrupt)
+		{
+			ServiceInterrupt();
+		}
+	}
+
+	void I8086::RequestInterrupt(u8 vector)
+	{
+		mPendingInterrupt = true;
+		mPendingVector = vector;
+	}
+
+	void I8086::ServiceInterrupt()
+	{
+		mPendingInterrupt = false;
+
+		INT(mPendingVector);
 	}
 
 	void I8086::GetInternalState(CPUState& state) const
@@ -413,6 +556,11 @@ namespace i8086
 		}
 	}
 
+	bool I8086::HasBreakpoint(u32 address) const
+	{
+		return std::find(mBreakpoints.begin(), mBreakpoints.end(), address) != mBreakpoints.end();
+	}
+
 	void I8086::CalculateEffectiveAddress()
 	{
 
@@ -557,30 +705,52 @@ namespace i8086
 		return mRegs16[reg]->X;
 	}
 
+	u16 I8086::PortRead(u16 port, u8 size)
+	{
+		const u16 data = mIOBus->Read(port, size);
+
+		if (mIOTracer)
+		{
+			mIOTracer->Record({ mCycles, CS.X, mInstrIP, port, data, size, false });
+		}
+
+		return data;
+	}
+
+	void I8086::PortWrite(u16 port, u16 data, u8 size)
+	{
+		if (mIOTracer)
+		{
+			mIOTracer->Record({ mCycles, CS.X, mInstrIP, port, data, size, true });
+		}
+
+		mIOBus->Write(port, data, size);
+	}
+
 	/* INSTRUCTIONS */
 
 	void I8086::PUSH(Register& reg)
 	{
 		SP.X -= 2;
-		mBus->Write(SP.X, reg.X, SS, WORD);
+		mBus->Write(SP.X, reg.X, SS, WORD, true);
 	}
 
 	void I8086::PUSH(u16 value)
 	{
 		SP.X -= 2;
-		mBus->Write(SP.X, value, SS, WORD);
+		mBus->Write(SP.X, value, SS, WORD, true);
 	}
 
 	void I8086::POP(Register& reg)
 	{
-		reg.X = mBus->Read(SP.X, SS, WORD);
+		reg.X = mBus->Read(SP.X, SS, WORD, true);
 		SP.X += 2;
 	}
 
 	u16 I8086::POP()
 	{
 		SP.X += 2;
-		return mBus->Read(SP.X - 2, SS, WORD);
+		return mBus->Read(SP.X - 2, SS, WORD, true);
 	}
 
 	void I8086::INT(u8 interruptNumber)
@@ -589,8 +759,11 @@ namespace i8086
 		PUSH(CS);
 		PUSH(IP);
 
-		IP = mBus->Read(interruptNumber, CS, WORD);
-		CS = mBus->Read(interruptNumber + 2, CS, WORD);
+		// the interrupt vector table lives at 0000:0000, 4 bytes per entry
+		const u16 vectorAddress = interruptNumber * 4;
+
+		IP = mBus->Read(vectorAddress, 0x0000, WORD, true);
+		CS = mBus->Read(vectorAddress + 2, 0x0000, WORD, true);
 
 		SF.I = 0;
 		SF.T = 0;
@@ -605,7 +778,7 @@ namespace i8086
 			return GetReg(Rm, operandSize);
 		}
 
-		return mBus->Read(EA, mSeg, operandSize);
+		return mBus->Read(EA, mSeg, operandSize, true);
 	}
 
 	void I8086::WriteRMOperand(u16 data, u8 operandSize)
@@ -616,7 +789,7 @@ namespace i8086
 			return;
 		}
 
-		mBus->Write(EA, data, mSeg, operandSize);
+		mBus->Write(EA, data, mSeg, operandSize, true);
 	}
 
 	// NOP
@@ -1697,7 +1870,7 @@ namespace i8086
 
 		if (Mod != 3)
 		{
-			mBus->Write(EA, regValue, mSeg, OperandSize);
+			mBus->Write(EA, regValue, mSeg, OperandSize, true);
 			SetReg(Reg, temp, OperandSize);
 			return;
 		}
@@ -1986,7 +2159,7 @@ namespace i8086
 	// POPF
 	void I8086::POPF()
 	{
-		SF.Set(mBus->Read(SP.X, SS, WORD));
+		SF.Set(mBus->Read(SP.X, SS, WORD, true));
 		SP.X += 2;
 	}
 
@@ -2007,32 +2180,32 @@ namespace i8086
 	// MOV AL, [addr]
 	void I8086::MOV_AL_MOFFS16()
 	{
-		A.L = mBus->Read(Fetch(WORD), DS, BYTE);
+		A.L = mBus->Read(Fetch(WORD), DS, BYTE, true);
 	}
 
 	// MOV AX, [addr]
 	void I8086::MOV_AX_MOFFS16()
 	{
-		A.X = mBus->Read(Fetch(WORD), DS, WORD);
+		A.X = mBus->Read(Fetch(WORD), DS, WORD, true);
 	}
 
 	// MOV [addr], AL
 	void I8086::MOV_MOFFS16_AL()
 	{
-		mBus->Write(Fetch(WORD), A.L, DS, BYTE);
+		mBus->Write(Fetch(WORD), A.L, DS, BYTE, true);
 	}
 
 	// MOV [addr], AX
 	void I8086::MOV_MOFFS16_AX()
 	{
-		mBus->Write(Fetch(WORD), A.X, DS, WORD);
+		mBus->Write(Fetch(WORD), A.X, DS, WORD, true);
 	}
 
 	// MOVSB
 	void I8086::MOVSB()
 	{
 
-		mBus->Write(DI.X, mBus->Read(SI.X, DS, BYTE), ES, BYTE);
+		mBus->Write(DI.X, mBus->Read(SI.X, DS, BYTE, true), ES, BYTE, true);
 
 		if (SF.D)
 		{
@@ -2052,7 +2225,7 @@ namespace i8086
 	void I8086::MOVSW()
 	{
 
-		mBus->Write(DI.X, mBus->Read(SI.X, DS, WORD), ES, WORD);
+		mBus->Write(DI.X, mBus->Read(SI.X, DS, WORD, true), ES, WORD, true);
 
 		if (SF.D)
 		{
@@ -2072,7 +2245,7 @@ namespace i8086
 	void I8086::CMPSB()
 	{
 
-		Instr::SUB(mBus->Read(SI.X, DS, BYTE), mBus->Read(DI.X, ES, BYTE), this);
+		Instr::SUB(mBus->Read(SI.X, DS, BYTE, true), mBus->Read(DI.X, ES, BYTE, true), this);
 
 		if (SF.D)
 		{
@@ -2092,7 +2265,7 @@ namespace i8086
 	void I8086::CMPSW()
 	{
 
-		Instr::SUB(mBus->Read(SI.X, DS, WORD), mBus->Read(DI.X, ES, WORD), this);
+		Instr::SUB(mBus->Read(SI.X, DS, WORD, true), mBus->Read(DI.X, ES, WORD, true), this);
 
 		if (SF.D)
 		{
@@ -2124,7 +2297,7 @@ namespace i8086
 	void I8086::STOSB()
 	{
 
-		mBus->Write(DI.X, A.L, ES, BYTE);
+		mBus->Write(DI.X, A.L, ES, BYTE, true);
 
 		if (SF.D)
 		{
@@ -2142,7 +2315,7 @@ namespace i8086
 	void I8086::STOSW()
 	{
 
-		mBus->Write(DI.X, A.X, ES, WORD);
+		mBus->Write(DI.X, A.X, ES, WORD, true);
 
 		if (SF.D)
 		{
@@ -2160,7 +2333,7 @@ namespace i8086
 	void I8086::LODSB()
 	{
 
-		A.L = mBus->Read(SI.X, DS, BYTE);
+		A.L = mBus->Read(SI.X, DS, BYTE, true);
 
 		if (SF.D)
 		{
@@ -2178,7 +2351,7 @@ namespace i8086
 	void I8086::LODSW()
 	{
 
-		A.X = mBus->Read(SI.X, DS, WORD);
+		A.X = mBus->Read(SI.X, DS, WORD, true);
 
 		if (SF.D)
 		{
@@ -2196,7 +2369,7 @@ namespace i8086
 	void I8086::SCASB()
 	{
 
-		Instr::SUB(mBus->Read(DI.X, ES, BYTE), A.L, this);
+		Instr::SUB(mBus->Read(DI.X, ES, BYTE, true), A.L, this);
 
 		if (SF.D)
 		{
@@ -2214,7 +2387,7 @@ namespace i8086
 	void I8086::SCASW()
 	{
 
-		Instr::SUB(mBus->Read(DI.X, ES, WORD), A.X, this);
+		Instr::SUB(mBus->Read(DI.X, ES, WORD, true), A.X, this);
 
 		if (SF.D)
 		{
@@ -2347,9 +2520,9 @@ namespace i8086
 
 		CalculateEffectiveAddress();
 
-		SetReg(Reg, mBus->Read(EA, mSeg, WORD), WORD);
+		SetReg(Reg, mBus->Read(EA, mSeg, WORD, true), WORD);
 
-		ES = mBus->Read(EA + 2, mSeg, WORD);
+		ES = mBus->Read(EA + 2, mSeg, WORD, true);
 	}
 
 	// LDS r16, [addr]
@@ -2359,9 +2532,9 @@ namespace i8086
 
 		CalculateEffectiveAddress();
 		
-		SetReg(Reg, mBus->Read(EA, mSeg, WORD), WORD);
+		SetReg(Reg, mBus->Read(EA, mSeg, WORD, true), WORD);
 
-		DS = mBus->Read(EA + 2, mSeg, WORD);
+		DS = mBus->Read(EA + 2, mSeg, WORD, true);
 
 	}
 
@@ -2423,7 +2596,14 @@ namespace i8086
 	// INT i8 - Software interrupt
 	void I8086::INT_I8()
 	{
-		const u8 interrupt = Fetch() * 4;
+		const u8 interrupt = Fetch();
+
+		IInterruptHandler* handler = mInterruptHandlers[interrupt];
+
+		if (handler && handler->HandleInterrupt(interrupt, *this))
+		{
+			return;
+		}
 
 		INT(interrupt);
 	}
@@ -2500,13 +2680,15 @@ namespace i8086
 	void I8086::XLAT()
 	{
 		const u16 offset = B.X + A.L;
-		A.L = mBus->Read(offset, DS, BYTE);
+		A.L = mBus->Read(offset, DS, BYTE, true);
 	}
 
 	// ESC - FPU instruction(not implemented)
 	void I8086::ESC()
 	{
-
+		// no coprocessor, the operand is only decoded so the instruction has its full length
+		FetchModrm();
+		CalculateEffectiveAddress();
 	}
 	
 	// LOOPNE/Z rel8
@@ -2566,25 +2748,25 @@ namespace i8086
 	// IN AL, i8
 	void I8086::IN_AL_I8()
 	{
-		// TODO
+		A.L = PortRead(Fetch(), BYTE);
 	}
 
 	// IN AX, i8
 	void I8086::IN_AX_I8()
 	{
-		// TODO
+		A.X = PortRead(Fetch(), WORD);
 	}
 
 	// OUT i8, AL
 	void I8086::OUT_I8_AL()
 	{
-		// TODO
+		PortWrite(Fetch(), A.L, BYTE);
 	}
 
 	// OUT i8, AX
 	void I8086::OUT_I8_AX()
 	{
-		// TODO
+		PortWrite(Fetch(), A.X, WORD);
 	}
 
 	// CALL rel16
@@ -2630,25 +2812,25 @@ namespace i8086
 	// IN AL, DX
 	void I8086::IN_AL_DX()
 	{
-		// TODO
+		A.L = PortRead(D.X, BYTE);
 	}
 
 	// IN AX, DX
 	void I8086::IN_AX_DX()
 	{
-		// TODO
+		A.X = PortRead(D.X, WORD);
 	}
 
 	// OUT DX, AL
 	void I8086::OUT_DX_AL()
 	{
-		// TODO
+		PortWrite(D.X, A.L, BYTE);
 	}
 
 	// OUT DX, AX
 	void I8086::OUT_DX_AX()
 	{
-		// TODO
+		PortWrite(D.X, A.X, WORD);
 	}
 
 	// LOCK prefix - Used to ensure exclusive use of shared memory in multiprocessor systems(Not implemented)
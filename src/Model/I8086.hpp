@@ -6,7 +6,14 @@
 
 #include "Register.hpp"
 #include "CPUState.hpp"
+#include "ExecutionTrace.hpp"
+#include "MemoryHeatMap.hpp"
 #include "MemoryBus.hpp"
+#include "IOBus.hpp"
+#include "IOTracer.hpp"
+#include "Scheduler.hpp"
+
+#include <Interfaces/IInterruptHandler.hpp>
 
 #include <vector>
 #include <array>
@@ -19,13 +26,51 @@ namespace i8086
 
 	public:
 
-		I8086(MemoryBus* const bus);
+		I8086(MemoryBus* const bus, IO::IOBus* const ioBus, Scheduler* const scheduler);
 
-		void Cycles(u8 count);
+		/**
+		 * @brief Runs count instructions, or stops before the first one at a breakpoint.
+		 *
+		 * @return Instructions run, count unless a breakpoint stopped the CPU (a halted CPU counts as running them).
+		 */
+		u8 Cycles(u8 count);
 
 		void GetInternalState(CPUState& state) const;
 
 		void SetBreakpoint(u32 address, bool state);
+		bool HasBreakpoint(u32 address) const;
+
+		/**
+		 * @brief True after Cycles stopped at a breakpoint, the instruction there runs on the next call.
+		 */
+		bool IsAtBreakpoint() const { return mAtBreakpoint; }
+
+		void AttachIOTracer(IO::IOTracer* tracer) { mIOTracer = tracer; }
+
+		/**
+		 * @brief Records every executed instruction into trace, nullptr stops recording.
+		 */
+		void AttachExecutionTrace(ExecutionTrace* trace) { mExecutionTrace = trace; }
+
+		/**
+		 * @brief Counts every executed instruction in heatMap, nullptr stops counting. Data accesses are counted by the bus.
+		 */
+		void AttachHeatMap(MemoryHeatMap* heatMap) { mHeatMap = heatMap; }
+
+		/**
+		 * @brief Services INT n in host code instead of through the IVT (nullptr restores the default).
+		 */
+		void SetInterruptHandler(u8 vector, IInterruptHandler* handler) { mInterruptHandlers[vector] = handler; }
+
+		u64 GetCycleCount() const { return mCycles; }
+		u64 GetInstructionCount() const { return mInstructions; }
+
+		/**
+		 * @brief Raises a maskable hardware interrupt, serviced before the next instruction if IF is set.
+		 */
+		void RequestInterrupt(u8 vector);
+
+		bool IsHalted() const { return mHalted; }
 
 	protected:
 
@@ -33,24 +78,49 @@ namespace i8086
 
 		void FetchModrm();
 		void HandleREP();
-		void ExecuteInstructions(u8 count);
+		u8 ExecuteInstructions(u8 count);
+		bool StopAtBreakpoint();
+		void FastForwardHalt();
+		void ServiceInterrupt();
+		void RecordExecution(u16 cs);
 		void CalculateEffectiveAddress();
 		void ApplyRegisterOverrideIfNeeded();
 
 		void SetReg(u8 reg, u16 value, u8 size);
 		u16 GetReg(u8 reg, u8 size) const;
 
+		u16 PortRead(u16 port, u8 size);
+		void PortWrite(u16 port, u16 data, u8 size);
+
 	protected:
 
 		MemoryBus* const mBus;
+		IO::IOBus* const mIOBus;
+		IO::IOTracer* mIOTracer{ nullptr };
+		ExecutionTrace* mExecutionTrace{ nullptr };
+		MemoryHeatMap* mHeatMap{ nullptr };
+		Scheduler* const mScheduler;
 		std::vector<u32> mBreakpoints;
 		std::array<void (I8086::*)(), 256> mOpcodeTable;
+		std::array<IInterruptHandler*, 256> mInterruptHandlers{};
 
 		bool mStepMode{ false };
 		bool mREP{ false };
 		bool mHalted{ false };
+		bool mAtBreakpoint{ false };
 		bool mPendingInterruptFlag{ false };
 
+		u64 mCycles{ 0 };   // clock cycles since reset, from the base timings of OpcodeTable
+		u64 mInstructions{ 0 };
+		u16 mInstrIP{ 0 };  // IP of the instruction being executed
+
+		std::array<u8, ExecutionTraceEntry::MAX_BYTES + 1> mFetchedBytes{}; // of the instruction being executed, while tracing
+		u8 mFetchedCount{ 0 };
+		bool mFetchedModrm{ false }; // by the instruction being executed, Reg is only its own then
+
+		bool mPendingInterrupt{ false };
+		u8 mPendingVector{ 0 };
+
 		/* Registers Maps */
 
 		std::array<Register*, 8> mRegs16 = {
@@ -0,0 +1,146 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "IOTracer.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <stdexcept>
+
+namespace i8086::IO
+{
+
+	constexpr size_t PORT_COUNT = 0x10000;
+	constexpr char TRACE_MAGIC[8] = { 'I', '8', '6', 'I', 'O', 'T', 'R', 'C' };
+	constexpr u32 TRACE_VERSION = 1;
+
+	template<typename T>
+	static inline void WriteLE(std::ostream& out, T value)
+	{
+		for (size_t i = 0; i < sizeof(T); ++i)
+		{
+			out.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+		}
+	}
+
+	IOTracer::IOTracer(size_t traceCapacity)
+		: mReadCounts(PORT_COUNT, 0), mWriteCounts(PORT_COUNT, 0), mTrace(traceCapacity)
+	{
+		if (traceCapacity == 0)
+		{
+			throw std::runtime_error("IOTracer::IOTracer -> Trace capacity must not be zero");
+		}
+	}
+
+	void IOTracer::Record(const IOTraceEntry& entry)
+	{
+		if (entry.Write)
+		{
+			mWriteCounts[entry.Port]++;
+		}
+
+		else
+		{
+			mReadCounts[entry.Port]++;
+		}
+
+		if (!mTraceEnabled)
+		{
+			return;
+		}
+
+		mTrace[mTraceHead] = entry;
+		mTraceHead = (mTraceHead + 1) % mTrace.size();
+		mTraceCount = std::min(mTraceCount + 1, mTrace.size());
+	}
+
+	void IOTracer::Reset()
+	{
+		std::fill(mReadCounts.begin(), mReadCounts.end(), 0);
+		std::fill(mWriteCounts.begin(), mWriteCounts.end(), 0);
+
+		mTraceHead = 0;
+		mTraceCount = 0;
+	}
+
+	const IOTraceEntry& IOTracer::GetTraceEntry(size_t index) const
+	{
+		if (index >= mTraceCount)
+		{
+			throw std::out_of_range("IOTracer::GetTraceEntry -> Index out of range");
+		}
+
+		// index 0 is the oldest entry still held by the ring buffer
+		const size_t oldest = (mTraceHead + mTrace.size() - mTraceCount) % mTrace.size();
+
+		return mTrace[(oldest + index) % mTrace.size()];
+	}
+
+	void IOTracer::ExportStatsCSV(std::ostream& out) const
+	{
+		std::vector<u16> ports;
+
+		for (size_t port = 0; port < PORT_COUNT; ++port)
+		{
+			if (mReadCounts[port] || mWriteCounts[port])
+			{
+				ports.push_back(static_cast<u16>(port));
+			}
+		}
+
+		// hottest ports first, these are the ones worth looking at
+		std::sort(ports.begin(), ports.end(), [this](u16 a, u16 b) {
+			return (mReadCounts[a] + mWriteCounts[a]) > (mReadCounts[b] + mWriteCounts[b]);
+		});
+
+		out << "port,reads,writes\n";
+
+		for (const u16 port : ports)
+		{
+			char row[64];
+			const int length = std::snprintf(row, sizeof(row), "0x%04X,%" PRIu64 ",%" PRIu64 "\n", port, mReadCounts[port], mWriteCounts[port]);
+
+			out.write(row, length);
+		}
+	}
+
+	void IOTracer::ExportTraceCSV(std::ostream& out) const
+	{
+		out << "cycle,cs,ip,port,value,width,direction\n";
+
+		for (size_t i = 0; i < mTraceCount; ++i)
+		{
+			const IOTraceEntry& entry = GetTraceEntry(i);
+
+			char row[96];
+			const int length = std::snprintf(row, sizeof(row), "%" PRIu64 ",0x%04X,0x%04X,0x%04X,0x%04X,%u,%s\n",
+				entry.Cycle, entry.CS, entry.IP, entry.Port, entry.Value, entry.Width, entry.Write ? "out" : "in");
+
+			out.write(row, length);
+		}
+	}
+
+	void IOTracer::ExportTraceBinary(std::ostream& out) const
+	{
+		// header: magic, version, entry count; entries are packed little-endian records
+		out.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+		WriteLE<u32>(out, TRACE_VERSION);
+		WriteLE<u64>(out, mTraceCount);
+
+		for (size_t i = 0; i < mTraceCount; ++i)
+		{
+			const IOTraceEntry& entry = GetTraceEntry(i);
+
+			WriteLE<u64>(out, entry.Cycle);
+			WriteLE<u16>(out, entry.CS);
+			WriteLE<u16>(out, entry.IP);
+			WriteLE<u16>(out, entry.Port);
+			WriteLE<u16>(out, entry.Value);
+			WriteLE<u8>(out, entry.Width);
+			WriteLE<u8>(out, entry.Write ? 1 : 0);
+		}
+	}
+
+} // namespace i8086::IO
@@ -0,0 +1,69 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <vector>
+#include <ostream>
+
+namespace i8086::IO
+{
+
+	struct IOTraceEntry
+	{
+		u64 Cycle{};
+		u16 CS{};
+		u16 IP{};
+		u16 Port{};
+		u16 Value{};
+		u8 Width{};
+		bool Write{ false };
+	};
+
+	/**
+	 * @brief Collects per-port access counters and an optional trace of port accesses.
+	 *
+	 * @details
+	 * The CPU only calls into the tracer when one is attached, so a detached tracer
+	 * costs a single branch per IN/OUT. The counters are always updated while attached,
+	 * the ring buffer only when the trace is enabled; once full, the oldest entries are
+	 * overwritten.
+	 */
+	class IOTracer
+	{
+
+	public:
+
+		IOTracer(size_t traceCapacity = 4096);
+
+		void Record(const IOTraceEntry& entry);
+		void Reset();
+
+		void SetTraceEnabled(bool enabled) { mTraceEnabled = enabled; }
+		bool IsTraceEnabled() const { return mTraceEnabled; }
+
+		u64 GetReadCount(u16 port) const { return mReadCounts[port]; }
+		u64 GetWriteCount(u16 port) const { return mWriteCounts[port]; }
+
+		size_t GetTraceSize() const { return mTraceCount; }
+		const IOTraceEntry& GetTraceEntry(size_t index) const;
+
+		void ExportStatsCSV(std::ostream& out) const;
+		void ExportTraceCSV(std::ostream& out) const;
+		void ExportTraceBinary(std::ostream& out) const;
+
+	private:
+
+		std::vector<u64> mReadCounts;
+		std::vector<u64> mWriteCounts;
+
+		std::vector<IOTraceEntry> mTrace;
+		size_t mTraceHead{ 0 };
+		size_t mTraceCount{ 0 };
+		bool mTraceEnabled{ false };
+	};
+
+} // namespace i8086::IO
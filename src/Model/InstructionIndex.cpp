@@ -0,0 +1,258 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "InstructionIndex.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace disassembler
+{
+
+	using i8086::IMemorySource;
+
+	InstructionIndex::~InstructionIndex()
+	{
+		Cancel();
+	}
+
+	void InstructionIndex::Build(u32 startAddress, u32 endAddress)
+	{
+		if (!mBus)
+		{
+			throw std::runtime_error("InstructionIndex::Build -> Memory bus is not initialized");
+		}
+
+		Cancel();
+
+		endAddress = std::min(endAddress, static_cast<u32>(mBus->GetSize()));
+
+		mCode.resize(endAddress > startAddress ? endAddress - startAddress : 0);
+		mBus->ReadBlock(startAddress, mCode);
+
+		mBuildVersions.clear();
+
+		for (u32 page = startAddress >> IMemorySource::PAGE_BITS; !mCode.empty() && page <= (endAddress - 1) >> IMemorySource::PAGE_BITS; ++page)
+		{
+			mBuildVersions.push_back(mBus->GetPageVersion(page));
+		}
+
+		Start(startAddress);
+	}
+
+	void InstructionIndex::Build(std::vector<u8> code, u32 startAddress)
+	{
+		Cancel();
+
+		mCode = std::move(code);
+		mBuildVersions.clear();
+
+		Start(startAddress);
+	}
+
+	void InstructionIndex::Start(u32 startAddress)
+	{
+		mStartAddress = startAddress;
+		mDecoder.SetSource(mCode, startAddress);
+
+		{
+			std::lock_guard lock(mMutex);
+			mChunks.clear();
+			mRowStarts.assign(1, 0);
+		}
+
+		mCancel = false;
+		mComplete = false;
+		mMaxInstrBytesCount = 0;
+		++mGeneration;
+
+		mThread = std::thread(&InstructionIndex::Worker, this);
+	}
+
+	void InstructionIndex::Cancel()
+	{
+		mCancel = true;
+
+		if (mThread.joinable())
+		{
+			mThread.join();
+		}
+	}
+
+	size_t InstructionIndex::GetRowCount() const
+	{
+		std::lock_guard lock(mMutex);
+
+		return mRowStarts.empty() ? 0 : mRowStarts.back();
+	}
+
+	void InstructionIndex::GetAddresses(size_t firstRow, size_t count, std::vector<u32>& outAddresses) const
+	{
+		std::lock_guard lock(mMutex);
+
+		outAddresses.clear();
+
+		if (mChunks.empty() || firstRow >= mRowStarts.back())
+		{
+			return;
+		}
+
+		// the chunk holding firstRow is the last one starting at or before it
+		size_t chunkIndex = std::upper_bound(mRowStarts.begin(), mRowStarts.end(), firstRow) - mRowStarts.begin() - 1;
+		size_t row = firstRow - mRowStarts[chunkIndex];
+
+		while (outAddresses.size() < count && chunkIndex < mChunks.size())
+		{
+			const auto& addresses = mChunks[chunkIndex].Addresses;
+			const size_t take = std::min(count - outAddresses.size(), addresses.size() - row);
+
+			outAddresses.insert(outAddresses.end(), addresses.begin() + row, addresses.begin() + row + take);
+
+			++chunkIndex;
+			row = 0;
+		}
+	}
+
+	void InstructionIndex::DecodeChunk(Chunk& chunk, u32 entry) const
+	{
+		chunk.Entry = entry;
+		chunk.Addresses.clear();
+
+		// an instruction may cross into the next chunk, the next chunk then starts after it
+		u32 address = entry;
+
+		while (address < chunk.End)
+		{
+			chunk.Addresses.push_back(address);
+			address += mDecoder.DecodeLength(address);
+		}
+
+		chunk.Exit = address;
+	}
+
+	void InstructionIndex::UpdateRowStarts()
+	{
+		mRowStarts.resize(mChunks.size() + 1);
+		mRowStarts[0] = 0;
+
+		for (size_t i = 0; i < mChunks.size(); ++i)
+		{
+			mRowStarts[i + 1] = mRowStarts[i] + mChunks[i].Addresses.size();
+		}
+	}
+
+	void InstructionIndex::Worker()
+	{
+		const auto begin = std::chrono::steady_clock::now();
+
+		const u32 endAddress = mStartAddress + static_cast<u32>(mCode.size());
+
+		u32 chunkStart = mStartAddress;
+		u32 entry = mStartAddress;
+		u8 maxLength = 0;
+
+		while (chunkStart < endAddress && !mCancel)
+		{
+			Chunk chunk;
+			chunk.Start = chunkStart;
+			chunk.End = std::min((chunkStart & ~(CHUNK_SIZE - 1)) + CHUNK_SIZE, endAddress);
+
+			const size_t chunkIndex = (chunkStart >> IMemorySource::PAGE_BITS) - (mStartAddress >> IMemorySource::PAGE_BITS);
+			chunk.Version = (chunkIndex < mBuildVersions.size()) ? mBuildVersions[chunkIndex] : 0;
+
+			DecodeChunk(chunk, entry);
+
+			for (size_t i = 1; i < chunk.Addresses.size(); ++i)
+			{
+				maxLength = std::max<u8>(maxLength, static_cast<u8>(chunk.Addresses[i] - chunk.Addresses[i - 1]));
+			}
+
+			entry = chunk.Exit;
+			chunkStart = chunk.End;
+
+			{
+				std::lock_guard lock(mMutex);
+				mRowStarts.push_back(mRowStarts.back() + chunk.Addresses.size());
+				mChunks.push_back(std::move(chunk));
+			}
+
+			mMaxInstrBytesCount = std::min<u8>(std::max<u8>(maxLength, 1), Instruction::MAX_BYTES);
+		}
+
+		if (mCancel)
+		{
+			return;
+		}
+
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+		mInstructionsPerSecond = seconds > 0.0 ? GetRowCount() / seconds : 0.0;
+		mComplete = true;
+	}
+
+	bool InstructionIndex::Refresh()
+	{
+		if (!mBus || mBuildVersions.empty() || !mComplete)
+		{
+			return false;
+		}
+
+		if (mThread.joinable())
+		{
+			mThread.join();
+		}
+
+		std::lock_guard lock(mMutex);
+
+		// copy the written pages first, an instruction at the end of one page reads the next
+		mDirty.assign(mChunks.size(), false);
+
+		bool anyDirty = false;
+
+		for (size_t i = 0; i < mChunks.size(); ++i)
+		{
+			Chunk& chunk = mChunks[i];
+			const u32 version = mBus->GetPageVersion(chunk.Start >> IMemorySource::PAGE_BITS);
+
+			if (version != chunk.Version)
+			{
+				const std::span<u8> bytes(mCode.data() + (chunk.Start - mStartAddress), chunk.End - chunk.Start);
+				mBus->ReadBlock(chunk.Start, bytes);
+
+				chunk.Version = version;
+				mDirty[i] = true;
+				anyDirty = true;
+			}
+		}
+
+		if (!anyDirty)
+		{
+			return false;
+		}
+
+		// then decode again where bytes changed or the previous page now ends elsewhere,
+		// the chain stops as soon as a page starts where it did before
+		u32 entry = mStartAddress;
+
+		for (size_t i = 0; i < mChunks.size(); ++i)
+		{
+			Chunk& chunk = mChunks[i];
+			const bool straddlesIntoDirty = (chunk.Exit > chunk.End) && (i + 1 < mChunks.size()) && mDirty[i + 1];
+
+			if (mDirty[i] || straddlesIntoDirty || chunk.Entry != entry)
+			{
+				DecodeChunk(chunk, entry);
+			}
+
+			entry = chunk.Exit;
+		}
+
+		UpdateRowStarts();
+		++mGeneration;
+
+		return true;
+	}
+
+} // namespace disassembler
@@ -0,0 +1,126 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "Disassembler.hpp"
+
+#include <Interfaces/IMemorySource.hpp>
+#include <Utils/types.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace disassembler
+{
+
+	/**
+	 * @brief Row to address map of a listing, built in the background and kept up to date per page.
+	 *
+	 * @details
+	 * Only instruction lengths are decoded, page by page over a private copy of the code, and
+	 * each finished page is published at once. A listing can show its first rows while the
+	 * rest of the range is still being indexed, and decodes the text of visible rows only.
+	 *
+	 * Each page remembers the bus write version its bytes were copied at and the address its
+	 * decode started from. Refresh re-copies and re-decodes pages written since, and pages
+	 * whose first instruction moved because of a change before them; the others are reused.
+	 */
+	class InstructionIndex
+	{
+
+	public:
+
+		static constexpr u32 CHUNK_SIZE = 1u << i8086::IMemorySource::PAGE_BITS;
+
+		InstructionIndex(const i8086::IMemorySource* bus = nullptr) : mBus(bus) {}
+		~InstructionIndex();
+
+		/**
+		 * @brief Snapshots [startAddress, endAddress) of the bus and starts indexing it.
+		 */
+		void Build(u32 startAddress, u32 endAddress);
+
+		/**
+		 * @brief Starts indexing code loaded at startAddress, such an index is never refreshed.
+		 */
+		void Build(std::vector<u8> code, u32 startAddress);
+
+		void Cancel();
+
+		/**
+		 * @brief Brings pages written on the bus since the last look up to date.
+		 *
+		 * @return true if rows were re-decoded. Does nothing while the first build is running.
+		 */
+		bool Refresh();
+
+		size_t GetRowCount() const;
+		bool IsComplete() const { return mComplete; }
+
+		/**
+		 * @brief Copies the addresses of rows [firstRow, firstRow + count) that are indexed already.
+		 */
+		void GetAddresses(size_t firstRow, size_t count, std::vector<u32>& outAddresses) const;
+
+		/**
+		 * @brief The indexed copy of the code, visible rows are decoded from it.
+		 */
+		std::span<const u8> GetCode() const { return mCode; }
+
+		/**
+		 * @brief Bumped whenever Refresh changes the index or the code.
+		 */
+		u64 GetGeneration() const { return mGeneration; }
+
+		u8 GetMaxInstrBytesCount() const { return mMaxInstrBytesCount; }
+
+		/**
+		 * @brief Indexing throughput of the last finished build, in instructions per second.
+		 */
+		double GetInstructionsPerSecond() const { return mInstructionsPerSecond; }
+
+	private:
+
+		struct Chunk
+		{
+			u32 Start{};
+			u32 End{};
+			u32 Entry{};   // address the decode started from
+			u32 Exit{};    // address after the last instruction, may be past End
+			u32 Version{}; // bus write version of the page when its bytes were copied
+			std::vector<u32> Addresses;
+		};
+
+		void Start(u32 startAddress);
+		void Worker();
+		void DecodeChunk(Chunk& chunk, u32 entry) const;
+		void UpdateRowStarts();
+
+	private:
+
+		const i8086::IMemorySource* const mBus;
+
+		std::vector<u8> mCode;
+		u32 mStartAddress{ 0 };
+		Disassembler mDecoder;
+
+		mutable std::mutex mMutex;
+		std::vector<Chunk> mChunks;
+		std::vector<size_t> mRowStarts; // first row of each chunk, plus the total row count
+		std::vector<u32> mBuildVersions;
+		std::vector<bool> mDirty;
+
+		std::thread mThread;
+		std::atomic<bool> mCancel{ false };
+		std::atomic<bool> mComplete{ true };
+		std::atomic<u8> mMaxInstrBytesCount{ 0 };
+		std::atomic<double> mInstructionsPerSecond{ 0.0 };
+		u64 mGeneration{ 0 };
+	};
+
+} // namespace disassembler
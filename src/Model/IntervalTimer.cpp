@@ -0,0 +1,146 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "IntervalTimer.hpp"
+
+#include <stdexcept>
+
+namespace i8086
+{
+
+	IntervalTimer::IntervalTimer(I8086* const cpu, Scheduler* const scheduler)
+		: IIODevice(CHANNEL0_PORT, CONTROL_PORT), mCpu(cpu), mScheduler(scheduler)
+	{
+		if (!mCpu || !mScheduler)
+		{
+			throw std::runtime_error("IntervalTimer::IntervalTimer -> CPU or scheduler is not initialized");
+		}
+
+		Restart(mCpu->GetCycleCount());
+	}
+
+	IntervalTimer::~IntervalTimer()
+	{
+		mScheduler->Cancel(mEvent);
+	}
+
+	u16 IntervalTimer::Read(u16 port, u8 size) const
+	{
+		if (port != CHANNEL0_PORT)
+		{
+			return 0xFF;
+		}
+
+		const u16 count = mLatched ? mLatch : GetCount();
+
+		if (mAccess == LowHighByte && size == 8)
+		{
+			// a latch holds until both of its bytes were read
+			const bool high = mReadHigh;
+
+			mReadHigh = !mReadHigh;
+			mLatched = mLatched && !high;
+
+			return high ? (count >> 8) : (count & 0xFF);
+		}
+
+		mLatched = false;
+
+		return (mAccess == HighByte) ? (count >> 8) : (size == 8) ? (count & 0xFF) : count;
+	}
+
+	void IntervalTimer::Write(u16 port, u16 data, u8 size)
+	{
+		const u8 value = data & 0xFF;
+
+		if (port == CONTROL_PORT)
+		{
+			// only channel 0 is there
+			if ((value >> 6) != 0)
+			{
+				return;
+			}
+
+			const Access access = static_cast<Access>((value >> 4) & 0x03);
+
+			if (access == Latch)
+			{
+				if (!mLatched)
+				{
+					mLatch = GetCount();
+					mLatched = true;
+				}
+
+				return;
+			}
+
+			mAccess = access;
+			mWriteHigh = false;
+			mReadHigh = false;
+			return;
+		}
+
+		if (port != CHANNEL0_PORT)
+		{
+			return;
+		}
+
+		switch (mAccess)
+		{
+
+		case LowByte:
+			mReload = value;
+			break;
+
+		case HighByte:
+			mReload = static_cast<u16>(value << 8);
+			break;
+
+		default:
+			if (size == 16)
+			{
+				mReload = data;
+				break;
+			}
+
+			if (!mWriteHigh)
+			{
+				mReloadLow = value;
+				mWriteHigh = true;
+				return;
+			}
+
+			mReload = static_cast<u16>((value << 8) | mReloadLow);
+			mWriteHigh = false;
+			break;
+		}
+
+		Restart(mCpu->GetCycleCount());
+	}
+
+	void IntervalTimer::Restart(u64 cycle)
+	{
+		mScheduler->Cancel(mEvent);
+
+		mPeriodStart = cycle;
+		mEvent = mScheduler->Schedule(mPeriodStart + GetPeriod(), [this]() { Tick(); });
+	}
+
+	void IntervalTimer::Tick()
+	{
+		mCpu->RequestInterrupt(IRQ0_VECTOR);
+
+		// from the cycle the tick was due at, an event run a few cycles late does not drift
+		Restart(mPeriodStart + GetPeriod());
+	}
+
+	u16 IntervalTimer::GetCount() const
+	{
+		const u64 ticks = GetPeriod() / CLOCK_DIVIDER;
+		const u64 elapsed = (mCpu->GetCycleCount() - mPeriodStart) / CLOCK_DIVIDER;
+
+		return static_cast<u16>(ticks - elapsed % ticks);
+	}
+
+} // namespace i8086
@@ -0,0 +1,85 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "I8086.hpp"
+#include "Scheduler.hpp"
+
+#include <Interfaces/IIODevice.hpp>
+#include <Utils/types.hpp>
+
+namespace i8086
+{
+
+	/**
+	 * @brief Channel 0 of the 8253 programmable interval timer, wired straight to IRQ0 (INT 08h).
+	 *
+	 * @details
+	 * The counter runs at a quarter of the CPU clock and raises IRQ0 each time it wraps. That
+	 * is a Scheduler event rather than a countdown per instruction, so a halted CPU jumps to
+	 * the next tick. It starts with the reload value a PC BIOS leaves, 0 for 65536, about 18.2
+	 * ticks per second at 4.77 MHz.
+	 *
+	 * Port 0x43 takes the control word of channel 0 (latch, low, high or low then high byte),
+	 * port 0x40 the reload value and the current count. Channels 1 and 2, BCD counting and
+	 * the one-shot modes are not emulated, every mode counts as the rate generator.
+	 */
+	class IntervalTimer : public IO::IIODevice
+	{
+
+	public:
+
+		static constexpr u16 CHANNEL0_PORT = 0x40;
+		static constexpr u16 CONTROL_PORT = 0x43;
+		static constexpr u8 IRQ0_VECTOR = 0x08;
+		static constexpr u32 CLOCK_DIVIDER = 4; // CPU cycles per counter tick
+
+		IntervalTimer(I8086* const cpu, Scheduler* const scheduler);
+		~IntervalTimer();
+
+		IntervalTimer(const IntervalTimer&) = delete;
+		IntervalTimer& operator=(const IntervalTimer&) = delete;
+
+		u16 Read(u16 port, u8 size) const override;
+		void Write(u16 port, u16 data, u8 size) override;
+
+		/**
+		 * @brief CPU cycles between two IRQ0.
+		 */
+		u64 GetPeriod() const { return static_cast<u64>(mReload ? mReload : 0x10000) * CLOCK_DIVIDER; }
+
+	private:
+
+		enum Access : u8
+		{
+			Latch,
+			LowByte,
+			HighByte,
+			LowHighByte
+		};
+
+		void Restart(u64 cycle);
+		void Tick();
+		u16 GetCount() const;
+
+	private:
+
+		I8086* const mCpu;
+		Scheduler* const mScheduler;
+
+		u16 mReload{ 0 };
+		u64 mPeriodStart{ 0 }; // cycle the counter was last reloaded or wrapped at
+		u32 mEvent{ 0 };
+
+		Access mAccess{ LowHighByte };
+		bool mWriteHigh{ false };  // next byte written in LowHighByte is the high one
+		u8 mReloadLow{ 0 };
+
+		mutable bool mReadHigh{ false };
+		mutable bool mLatched{ false };
+		mutable u16 mLatch{ 0 };
+	};
+
+} // namespace i8086
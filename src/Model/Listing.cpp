@@ -0,0 +1,112 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Listing.hpp"
+#include "Disassembler.hpp"
+
+#include <algorithm>
+
+namespace disassembler
+{
+
+	void Listing::Reset(std::span<const u8> code, u32 baseAddress)
+	{
+		mCode.assign(code.begin(), code.end());
+		mBaseAddress = baseAddress;
+		mEndAddress = baseAddress;
+
+		mAddresses.clear();
+		mIds.clear();
+		mOperand1.clear();
+		mOperand2.clear();
+	}
+
+	void Listing::Reserve(size_t rows)
+	{
+		mAddresses.reserve(rows);
+		mIds.reserve(rows);
+		mOperand1.reserve(rows);
+		mOperand2.reserve(rows);
+	}
+
+	void Listing::Push(const Instruction& instr)
+	{
+		const Operand& first = instr.Operands[0];
+		const Operand& second = instr.Operands[1];
+
+		mAddresses.push_back(instr.Address);
+		mIds.push_back(instr.Id);
+		mOperand1.push_back(first.Value);
+
+		// a far pointer is the only operand of its instruction, its segment takes the second slot
+		mOperand2.push_back(first.Type == segAddr ? first.Segment : second.Value);
+
+		mEndAddress = instr.Address + instr.Length;
+	}
+
+	u8 Listing::GetLength(size_t row) const
+	{
+		const u32 next = (row + 1 < mAddresses.size()) ? mAddresses[row + 1] : mEndAddress;
+
+		return static_cast<u8>(next - mAddresses[row]);
+	}
+
+	Instruction Listing::Get(size_t row) const
+	{
+		Instruction instr;
+		instr.Address = mAddresses[row];
+		instr.Length = GetLength(row);
+		instr.Id = mIds[row];
+
+		const u32 offset = instr.Address - mBaseAddress;
+
+		std::copy_n(mCode.begin() + offset, std::min<size_t>(instr.Length, mCode.size() - offset), instr.Bytes.begin());
+
+		const i8086::OpcodeInfo& info = (instr.Id >= Disassembler::GROUP_ID_BASE)
+			? i8086::GroupTable[instr.Id - Disassembler::GROUP_ID_BASE]
+			: i8086::OpcodeTable[instr.Id];
+
+		if (i8086::OpcodeTable[instr.Bytes[0]].HasModRM)
+		{
+			instr.ModRM = instr.Bytes[1];
+		}
+
+		instr.Operands[0].Type = info.Operand1;
+		instr.Operands[1].Type = info.Operand2;
+		instr.Operands[0].Value = mOperand1[row];
+
+		if (info.Operand1 == segAddr)
+		{
+			instr.Operands[0].Segment = mOperand2[row];
+		}
+
+		else
+		{
+			instr.Operands[1].Value = mOperand2[row];
+		}
+
+		return instr;
+	}
+
+	size_t Listing::FindRow(u32 address) const
+	{
+		if (mAddresses.empty() || address < mAddresses.front() || address >= mEndAddress)
+		{
+			return NOT_FOUND;
+		}
+
+		// the last row starting at or before address
+		return static_cast<size_t>(std::upper_bound(mAddresses.begin(), mAddresses.end(), address) - mAddresses.begin()) - 1;
+	}
+
+	size_t Listing::GetMemoryUsage() const
+	{
+		return mCode.capacity() * sizeof(u8)
+			+ mAddresses.capacity() * sizeof(u32)
+			+ mIds.capacity() * sizeof(u16)
+			+ mOperand1.capacity() * sizeof(u16)
+			+ mOperand2.capacity() * sizeof(u16);
+	}
+
+} // namespace disassembler
@@ -0,0 +1,84 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <span>
+#include <vector>
+
+namespace disassembler
+{
+
+	struct Instruction;
+
+	/**
+	 * @brief Decoded listing of a whole range, stored column by column.
+	 *
+	 * @details
+	 * A listing of all of memory has about half a million rows, so a row keeps only what
+	 * cannot be recomputed cheaply: its address, instruction id and two operand values.
+	 * Raw bytes come from one copy of the decoded code, lengths from the next address, and
+	 * text is not stored at all: Get rebuilds the Instruction of a row, which is formatted
+	 * when it is shown. That is about 10 bytes per instruction plus the code itself.
+	 *
+	 * Rows are in address order, FindRow is a binary search.
+	 */
+	class Listing
+	{
+
+	public:
+
+		static constexpr size_t NOT_FOUND = ~size_t{ 0 };
+
+		/**
+		 * @brief Empties the listing and copies the code its rows will be decoded from.
+		 *
+		 * @details
+		 * code may extend past the decoded range, the last instruction can read up to 5 bytes further.
+		 */
+		void Reset(std::span<const u8> code, u32 baseAddress);
+
+		void Reserve(size_t rows);
+
+		void Push(const Instruction& instr);
+
+		size_t Size() const { return mAddresses.size(); }
+		bool IsEmpty() const { return mAddresses.empty(); }
+
+		u32 GetAddress(size_t row) const { return mAddresses[row]; }
+		u8 GetLength(size_t row) const;
+		u16 GetId(size_t row) const { return mIds[row]; }
+
+		std::span<const u32> GetAddresses() const { return mAddresses; }
+
+		/**
+		 * @brief The instruction of row with its bytes and operands, ready to be formatted.
+		 */
+		Instruction Get(size_t row) const;
+
+		/**
+		 * @brief Row of the instruction that contains address, NOT_FOUND if it is outside the listing.
+		 */
+		size_t FindRow(u32 address) const;
+
+		/**
+		 * @brief Bytes held by the listing, code copy included.
+		 */
+		size_t GetMemoryUsage() const;
+
+	private:
+
+		std::vector<u8> mCode;
+		u32 mBaseAddress{ 0 };
+		u32 mEndAddress{ 0 }; // address after the last instruction
+
+		std::vector<u32> mAddresses;
+		std::vector<u16> mIds;
+		std::vector<u16> mOperand1; // value of the first operand
+		std::vector<u16> mOperand2; // value of the second operand, or segment of a far pointer
+	};
+
+} // namespace disassembler
@@ -27,6 +27,13 @@ namespace i8086
         }
 
         mMappings.push_back({ device, startAddress, endAddress });
+
+        const size_t pageCount = (static_cast<size_t>(endAddress) >> PAGE_BITS) + 1;
+
+        if (pageCount > mPageVersions.size())
+        {
+            mPageVersions.resize(pageCount, 0);
+        }
     }
 
     void i8086::MemoryBus::DetachDevice(IMemoryDevice* device)
@@ -48,6 +55,8 @@ namespace i8086
 
     u16 i8086::MemoryBus::Read(u16 address, const Register& segment, u8 size, bool notify) const
     {
+        ++mReadCount;
+
         const u32 segmentedAddress = (segment.X << 4) + address;
 
         for (const auto& mapping : mMappings)
@@ -72,6 +81,8 @@ namespace i8086
 
     void i8086::MemoryBus::Write(u16 address, u16 data, const Register& segment, u8 size, bool notify)
     {
+        ++mWriteCount;
+
         const u32 physicalAddress = (segment.X << 4) + address;
 
         for (const auto& mapping : mMappings)
@@ -79,6 +90,7 @@ namespace i8086
             if (physicalAddress >= mapping.startAddress && physicalAddress <= mapping.endAddress)
             {
                 mapping.device->Write(physicalAddress - mapping.startAddress, data, size);
+                MarkWritten(physicalAddress, physicalAddress + (size / 8) - 1);
                 
                 if (notify)
                 {
@@ -96,17 +108,81 @@ namespace i8086
 
     }
 
+    void MemoryBus::ReadBlock(u32 physicalAddress, std::span<u8> buffer) const
+    {
+        while (!buffer.empty())
+        {
+            const Mapping* mapping = FindMapping(physicalAddress);
+
+            if (mapping == nullptr)
+            {
+                throw std::runtime_error("MemoryBus::ReadBlock -> No device mapped to the given address");
+            }
+
+            const size_t available = static_cast<size_t>(mapping->endAddress - physicalAddress) + 1;
+            const size_t count = std::min(available, buffer.size());
+
+            mapping->device->ReadBlock(physicalAddress - mapping->startAddress, buffer.first(count));
+
+            buffer = buffer.subspan(count);
+            physicalAddress += static_cast<u32>(count);
+        }
+    }
+
+    void MemoryBus::WriteBlock(u32 physicalAddress, std::span<const u8> data)
+    {
+        while (!data.empty())
+        {
+            const Mapping* mapping = FindMapping(physicalAddress);
+
+            if (mapping == nullptr)
+            {
+                throw std::runtime_error("MemoryBus::WriteBlock -> No device mapped to the given address");
+            }
+
+            const size_t available = static_cast<size_t>(mapping->endAddress - physicalAddress) + 1;
+            const size_t count = std::min(available, data.size());
+
+            mapping->device->WriteBlock(physicalAddress - mapping->startAddress, data.first(count));
+            MarkWritten(physicalAddress, physicalAddress + static_cast<u32>(count) - 1);
+
+            data = data.subspan(count);
+            physicalAddress += static_cast<u32>(count);
+        }
+    }
+
+    void MemoryBus::MarkWritten(u32 firstAddress, u32 lastAddress)
+    {
+        if (mPageVersions.empty())
+        {
+            return;
+        }
+
+        const u32 lastPage = std::min<u32>(lastAddress >> PAGE_BITS, static_cast<u32>(mPageVersions.size()) - 1);
+
+        for (u32 page = firstAddress >> PAGE_BITS; page <= lastPage; ++page)
+        {
+            ++mPageVersions[page];
+        }
+    }
+
     void MemoryBus::DumpMemory(std::vector<u8> &outMemory) const
     {
+        size_t extent = 0;
+
+        for (const auto& mapping : mMappings)
+        {
+            extent = std::max(extent, static_cast<size_t>(mapping.endAddress) + 1);
+        }
+
         outMemory.clear();
-        outMemory.resize(GetSize(), 0);
+        outMemory.resize(extent, 0);
 
         for (const auto& mapping : mMappings)
         {
-            for (u32 i = 0; i <= mapping.endAddress; ++i)
-            {
-                outMemory[mapping.startAddress + i] = mapping.device->Read(i, 8);
-            }
+            const size_t mappingSize = static_cast<size_t>(mapping.endAddress - mapping.startAddress) + 1;
+
+            mapping.device->ReadBlock(0, std::span<u8>(outMemory.data() + mapping.startAddress, mappingSize));
         }
     }
 
@@ -122,6 +198,19 @@ namespace i8086
         return totalSize;
     }
 
+    const MemoryBus::Mapping* MemoryBus::FindMapping(u32 physicalAddress) const
+    {
+        for (const auto& mapping : mMappings)
+        {
+            if (physicalAddress >= mapping.startAddress && physicalAddress <= mapping.endAddress)
+            {
+                return &mapping;
+            }
+        }
+
+        return nullptr;
+    }
+
     void MemoryBus::RegisterObserver(IMemoryObserver* observer)
     {
         mObservers.push_back(observer);
@@ -6,16 +6,18 @@
 
 #include "Register.hpp"
 #include <Interfaces/IMemoryObserver.hpp>
+#include <Interfaces/IMemorySource.hpp>
 #include <Interfaces/IMemoryDevice.hpp>
 #include <Utils/types.hpp>
 
 #include <vector>
+#include <span>
 #include <algorithm>
 
 namespace i8086
 {
 
-    class MemoryBus
+    class MemoryBus : public IMemorySource
     {
 
     public:
@@ -26,8 +28,43 @@ namespace i8086
         u16 Read(u16 address, const Register& segment, u8 size, bool notify = false) const;
         void Write(u16 address, u16 data, const Register& segment, u8 size, bool notify = false);
 
+        /**
+         * @brief Block transfers on physical addresses.
+         *
+         * @details
+         * Ranges may span several mappings, each part is forwarded to its device as a
+         * single block. Observers are not notified, these are meant for loaders and
+         * debugger views rather than CPU accesses.
+         */
+        void ReadBlock(u32 physicalAddress, std::span<u8> buffer) const override;
+        void WriteBlock(u32 physicalAddress, std::span<const u8> data);
+
+        /**
+         * @brief Write counter of a page, bumped by every write that touches it.
+         *
+         * @details
+         * Lets caches built from memory contents (disassembly listings) find out which pages
+         * changed without comparing bytes. Pages are 4 KiB, physicalAddress >> PAGE_BITS.
+         */
+        u32 GetPageVersion(u32 page) const override
+        {
+            return (page < mPageVersions.size()) ? mPageVersions[page] : 0;
+        }
+
+        /**
+         * @brief Bumps the versions of the pages in [firstAddress, lastAddress], for devices
+         * written behind the bus' back (file loaders).
+         */
+        void MarkWritten(u32 firstAddress, u32 lastAddress);
+
         void DumpMemory(std::vector<u8>& outMemory) const;
-        size_t GetSize() const;
+        size_t GetSize() const override;
+
+        /**
+         * @brief Read and Write calls since creation, block transfers excluded.
+         */
+        u64 GetReadCount() const { return mReadCount; }
+        u64 GetWriteCount() const { return mWriteCount; }
 
         void RegisterObserver(IMemoryObserver* observer);
         void UnregisterObserver(IMemoryObserver* observer);
@@ -41,8 +78,14 @@ namespace i8086
             u32 endAddress{ 0 };
         };
 
+        const Mapping* FindMapping(u32 physicalAddress) const;
+
         std::vector<Mapping> mMappings;
         std::vector<IMemoryObserver*> mObservers;
+        std::vector<u32> mPageVersions;
+
+        mutable u64 mReadCount{ 0 };
+        u64 mWriteCount{ 0 };
     };
 
 } // namespace i8086
\ No newline at end of file
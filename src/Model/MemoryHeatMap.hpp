@@ -0,0 +1,73 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Interfaces/IMemoryObserver.hpp>
+#include <Utils/types.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace i8086
+{
+
+	/**
+	 * @brief Read, write and execute counts of each BLOCK_SIZE bytes of the 1 MiB address space.
+	 *
+	 * @details
+	 * Registered as a bus observer on the emulation thread for data accesses, the CPU adds the
+	 * instructions it executes (I8086::AttachHeatMap). An access is one increment in a flat
+	 * table. Counts only grow (wrapping at 2^32), whoever shows them takes the difference
+	 * between two copies and decays it; accesses past 1 MiB are not counted.
+	 */
+	class MemoryHeatMap : public IMemoryObserver
+	{
+
+	public:
+
+		static constexpr u32 BLOCK_BITS = 8;
+		static constexpr u32 BLOCK_SIZE = 1u << BLOCK_BITS;
+		static constexpr size_t BLOCK_COUNT = (1u << 20) >> BLOCK_BITS;
+
+		enum Kind
+		{
+			Read,
+			Write,
+			Execute,
+			KIND_COUNT
+		};
+
+		MemoryHeatMap() : mCounts(KIND_COUNT * BLOCK_COUNT, 0) {}
+
+		void OnRead(u32 address) override { Count(Read, address); }
+		void OnWrite(u32 address, u16 /*data*/) override { Count(Write, address); }
+		void OnExecute(u32 address) { Count(Execute, address); }
+
+		/**
+		 * @brief Counts of all blocks of each kind in turn, see GetIndex.
+		 */
+		std::span<const u32> GetCounts() const { return mCounts; }
+
+		static size_t GetIndex(Kind kind, size_t block) { return kind * BLOCK_COUNT + block; }
+
+	private:
+
+		void Count(Kind kind, u32 address)
+		{
+			const u32 block = address >> BLOCK_BITS;
+
+			if (block < BLOCK_COUNT)
+			{
+				++mCounts[GetIndex(kind, block)];
+			}
+		}
+
+	private:
+
+		std::vector<u32> mCounts;
+	};
+
+} // namespace i8086
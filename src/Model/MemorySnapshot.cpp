@@ -0,0 +1,55 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "MemorySnapshot.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace i8086
+{
+
+	void MemorySnapshot::Update(const MemoryBus& bus)
+	{
+		constexpr u32 PAGE_SIZE = 1u << PAGE_BITS;
+
+		const size_t size = bus.GetSize();
+
+		if (size != mMemory.size())
+		{
+			mMemory.assign(size, 0);
+			mVersions.assign((size + PAGE_SIZE - 1) >> PAGE_BITS, 0);
+			mValid.assign(mVersions.size(), false);
+		}
+
+		for (u32 page = 0; page < mVersions.size(); ++page)
+		{
+			const u32 version = bus.GetPageVersion(page);
+
+			if (mValid[page] && mVersions[page] == version)
+			{
+				continue;
+			}
+
+			const u32 first = page << PAGE_BITS;
+			const size_t count = std::min<size_t>(PAGE_SIZE, size - first);
+
+			bus.ReadBlock(first, std::span<u8>(mMemory.data() + first, count));
+
+			mVersions[page] = version;
+			mValid[page] = true;
+		}
+	}
+
+	void MemorySnapshot::ReadBlock(u32 physicalAddress, std::span<u8> buffer) const
+	{
+		if (physicalAddress > mMemory.size() || buffer.size() > mMemory.size() - physicalAddress)
+		{
+			throw std::runtime_error("MemorySnapshot::ReadBlock -> Range is outside of the snapshot");
+		}
+
+		std::copy_n(mMemory.begin() + physicalAddress, buffer.size(), buffer.begin());
+	}
+
+} // namespace i8086
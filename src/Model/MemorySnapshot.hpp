@@ -0,0 +1,49 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "MemoryBus.hpp"
+
+#include <Interfaces/IMemorySource.hpp>
+#include <Utils/types.hpp>
+
+#include <span>
+#include <vector>
+
+namespace i8086
+{
+
+	/**
+	 * @brief Copy of the whole address space, brought up to date page by page.
+	 *
+	 * @details
+	 * Each page remembers the bus write version it was copied at, Update copies only the
+	 * pages written since. Readers on another thread see the memory as it was at the last
+	 * Update, with the bus page versions of that moment.
+	 */
+	class MemorySnapshot : public IMemorySource
+	{
+
+	public:
+
+		/**
+		 * @brief Copies the pages of bus written since the last update, must run on the thread that owns the bus.
+		 */
+		void Update(const MemoryBus& bus);
+
+		void ReadBlock(u32 physicalAddress, std::span<u8> buffer) const override;
+		size_t GetSize() const override { return mMemory.size(); }
+		u32 GetPageVersion(u32 page) const override { return (page < mVersions.size()) ? mVersions[page] : 0; }
+
+		std::span<const u8> GetData() const { return mMemory; }
+
+	private:
+
+		std::vector<u8> mMemory;
+		std::vector<u32> mVersions;
+		std::vector<bool> mValid;
+	};
+
+} // namespace i8086
@@ -0,0 +1,576 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <array>
+
+namespace i8086
+{
+
+	enum OperandType : s8
+	{
+		none,
+		implied,
+		rel8,
+		rel16,
+		se8,
+		i8,
+		i16,
+		rm8,
+		rm16,
+		r8,
+		r16,
+		addr,
+		segAddr
+	};
+
+	enum BranchKind : u8
+	{
+		NoBranch,
+		Jump,
+		ConditionalJump,
+		Call,
+		Return,
+		Interrupt,
+		InterruptReturn,
+		Halt
+	};
+
+	enum PrefixKind : u8
+	{
+		NoPrefix,
+		SegmentPrefix,
+		RepeatPrefix,
+		LockPrefix
+	};
+
+	/**
+	 * @brief What the CPU, the disassembler and the length decoder know about an opcode.
+	 *
+	 * @details
+	 * Mnemonic is a template where each {} is replaced by the next operand. Cycles is the
+	 * base 8086 timing of the register form (memory operands, taken branches and repeats
+	 * cost more on real hardware). Opcodes that select their operation with the reg field
+	 * of the ModR/M byte have a Group and are described per reg in GroupTable.
+	 */
+	struct OpcodeInfo
+	{
+		const char* Mnemonic{ "" };
+		OperandType Operand1{ none };
+		OperandType Operand2{ none };
+		bool HasModRM{ false };
+		u8 Cycles{ 0 };
+		BranchKind Branch{ NoBranch };
+		PrefixKind Prefix{ NoPrefix };
+		s8 Group{ -1 };
+	};
+
+	constexpr std::array<const OpcodeInfo, 256> OpcodeTable =
+	{{
+		{ "ADD {}, {}",     rm8,      r8,       true,    3 },                          // 0x00
+		{ "ADD {}, {}",     rm16,     r16,      true,    3 },                          // 0x01
+		{ "ADD {}, {}",     r8,       rm8,      true,    3 },                          // 0x02
+		{ "ADD {}, {}",     r16,      rm16,     true,    3 },                          // 0x03
+		{ "ADD AL, {}{}",   implied,  i8,       false,   4 },                          // 0x04
+		{ "ADD AX, {}{}",   implied,  i16,      false,   4 },                          // 0x05
+		{ "PUSH ES",        implied,  none,     false,  10 },                          // 0x06
+		{ "POP ES",         implied,  none,     false,   8 },                          // 0x07
+		{ "OR {}, {}",      rm8,      r8,       true,    3 },                          // 0x08
+		{ "OR {}, {}",      rm16,     r16,      true,    3 },                          // 0x09
+		{ "OR {}, {}",      r8,       rm8,      true,    3 },                          // 0x0A
+		{ "OR {}, {}",      r16,      rm16,     true,    3 },                          // 0x0B
+		{ "OR AL, {}{}",    implied,  i8,       false,   4 },                          // 0x0C
+		{ "OR AX, {}{}",    implied,  i16,      false,   4 },                          // 0x0D
+		{ "PUSH CS",        implied,  none,     false,  10 },                          // 0x0E
+		{ "POP CS",         implied,  none,     false,   8 },                          // 0x0F
+		{ "ADC {}, {}",     rm8,      r8,       true,    3 },                          // 0x10
+		{ "ADC {}, {}",     rm16,     r16,      true,    3 },                          // 0x11
+		{ "ADC {}, {}",     r8,       rm8,      true,    3 },                          // 0x12
+		{ "ADC {}, {}",     r16,      rm16,     true,    3 },                          // 0x13
+		{ "ADC AL, {}{}",   implied,  i8,       false,   4 },                          // 0x14
+		{ "ADC AX, {}{}",   implied,  i16,      false,   4 },                          // 0x15
+		{ "PUSH SS",        implied,  none,     false,  10 },                          // 0x16
+		{ "POP SS",         implied,  none,     false,   8 },                          // 0x17
+		{ "SBB {}, {}",     rm8,      r8,       true,    3 },                          // 0x18
+		{ "SBB {}, {}",     rm16,     r16,      true,    3 },                          // 0x19
+		{ "SBB {}, {}",     r8,       rm8,      true,    3 },                          // 0x1A
+		{ "SBB {}, {}",     r16,      rm16,     true,    3 },                          // 0x1B
+		{ "SBB AL, {}{}",   implied,  i8,       false,   4 },                          // 0x1C
+		{ "SBB AX, {}{}",   implied,  i16,      false,   4 },                          // 0x1D
+		{ "PUSH DS",        implied,  none,     false,  10 },                          // 0x1E
+		{ "POP DS",         implied,  none,     false,   8 },                          // 0x1F
+		{ "AND {}, {}",     rm8,      r8,       true,    3 },                          // 0x20
+		{ "AND {}, {}",     rm16,     r16,      true,    3 },                          // 0x21
+		{ "AND {}, {}",     r8,       rm8,      true,    3 },                          // 0x22
+		{ "AND {}, {}",     r16,      rm16,     true,    3 },                          // 0x23
+		{ "AND AL, {}{}",   implied,  i8,       false,   4 },                          // 0x24
+		{ "AND AX, {}{}",   implied,  i16,      false,   4 },                          // 0x25
+		{ "ES:",            none,     none,     false,   2, NoBranch, SegmentPrefix }, // 0x26
+		{ "DAA",            none,     none,     false,   4 },                          // 0x27
+		{ "SUB {}, {}",     rm8,      r8,       true,    3 },                          // 0x28
+		{ "SUB {}, {}",     rm16,     r16,      true,    3 },                          // 0x29
+		{ "SUB {}, {}",     r8,       rm8,      true,    3 },                          // 0x2A
+		{ "SUB {}, {}",     r16,      rm16,     true,    3 },                          // 0x2B
+		{ "SUB AL, {}{}",   implied,  i8,       false,   4 },                          // 0x2C
+		{ "SUB AX, {}{}",   implied,  i16,      false,   4 },                          // 0x2D
+		{ "CS:",            none,     none,     false,   2, NoBranch, SegmentPrefix }, // 0x2E
+		{ "DAS",            none,     none,     false,   4 },                          // 0x2F
+		{ "XOR {}, {}",     rm8,      r8,       true,    3 },                          // 0x30
+		{ "XOR {}, {}",     rm16,     r16,      true,    3 },                          // 0x31
+		{ "XOR {}, {}",     r8,       rm8,      true,    3 },                          // 0x32
+		{ "XOR {}, {}",     r16,      rm16,     true,    3 },                          // 0x33
+		{ "XOR AL, {}{}",   implied,  i8,       false,   4 },                          // 0x34
+		{ "XOR AX, {}{}",   implied,  i16,      false,   4 },                          // 0x35
+		{ "SS:",            none,     none,     false,   2, NoBranch, SegmentPrefix }, // 0x36
+		{ "AAA",            none,     none,     false,   4 },                          // 0x37
+		{ "CMP {}, {}",     rm8,      r8,       true,    3 },                          // 0x38
+		{ "CMP {}, {}",     rm16,     r16,      true,    3 },                          // 0x39
+		{ "CMP {}, {}",     r8,       rm8,      true,    3 },                          // 0x3A
+		{ "CMP {}, {}",     r16,      rm16,     true,    3 },                          // 0x3B
+		{ "CMP AL, {}{}",   implied,  i8,       false,   4 },                          // 0x3C
+		{ "CMP AX, {}{}",   implied,  i16,      false,   4 },                          // 0x3D
+		{ "DS:",            none,     none,     false,   2, NoBranch, SegmentPrefix }, // 0x3E
+		{ "AAS",            none,     none,     false,   4 },                          // 0x3F
+		{ "INC AX",         implied,  none,     false,   2 },                          // 0x40
+		{ "INC CX",         implied,  none,     false,   2 },                          // 0x41
+		{ "INC DX",         implied,  none,     false,   2 },                          // 0x42
+		{ "INC BX",         implied,  none,     false,   2 },                          // 0x43
+		{ "INC SP",         implied,  none,     false,   2 },                          // 0x44
+		{ "INC BP",         implied,  none,     false,   2 },                          // 0x45
+		{ "INC SI",         implied,  none,     false,   2 },                          // 0x46
+		{ "INC DI",         implied,  none,     false,   2 },                          // 0x47
+		{ "DEC AX",         implied,  none,     false,   2 },                          // 0x48
+		{ "DEC CX",         implied,  none,     false,   2 },                          // 0x49
+		{ "DEC DX",         implied,  none,     false,   2 },                          // 0x4A
+		{ "DEC BX",         implied,  none,     false,   2 },                          // 0x4B
+		{ "DEC SP",         implied,  none,     false,   2 },                          // 0x4C
+		{ "DEC BP",         implied,  none,     false,   2 },                          // 0x4D
+		{ "DEC SI",         implied,  none,     false,   2 },                          // 0x4E
+		{ "DEC DI",         implied,  none,     false,   2 },                          // 0x4F
+		{ "PUSH AX",        implied,  none,     false,  11 },                          // 0x50
+		{ "PUSH CX",        implied,  none,     false,  11 },                          // 0x51
+		{ "PUSH DX",        implied,  none,     false,  11 },                          // 0x52
+		{ "PUSH BX",        implied,  none,     false,  11 },                          // 0x53
+		{ "PUSH SP",        implied,  none,     false,  11 },                          // 0x54
+		{ "PUSH BP",        implied,  none,     false,  11 },                          // 0x55
+		{ "PUSH SI",        implied,  none,     false,  11 },                          // 0x56
+		{ "PUSH DI",        implied,  none,     false,  11 },                          // 0x57
+		{ "POP AX",         implied,  none,     false,   8 },                          // 0x58
+		{ "POP CX",         implied,  none,     false,   8 },                          // 0x59
+		{ "POP DX",         implied,  none,     false,   8 },                          // 0x5A
+		{ "POP BX",         implied,  none,     false,   8 },                          // 0x5B
+		{ "POP SP",         implied,  none,     false,   8 },                          // 0x5C
+		{ "POP BP",         implied,  none,     false,   8 },                          // 0x5D
+		{ "POP SI",         implied,  none,     false,   8 },                          // 0x5E
+		{ "POP DI",         implied,  none,     false,   8 },                          // 0x5F
+		{ "NOP",            none,     none,     false,   3 },                          // 0x60
+		{ "NOP",            none,     none,     false,   3 },                          // 0x61
+		{ "NOP",            none,     none,     false,   3 },                          // 0x62
+		{ "NOP",            none,     none,     false,   3 },                          // 0x63
+		{ "NOP",            none,     none,     false,   3 },                          // 0x64
+		{ "NOP",            none,     none,     false,   3 },                          // 0x65
+		{ "NOP",            none,     none,     false,   3 },                          // 0x66
+		{ "NOP",            none,     none,     false,   3 },                          // 0x67
+		{ "NOP",            none,     none,     false,   3 },                          // 0x68
+		{ "NOP",            none,     none,     false,   3 },                          // 0x69
+		{ "NOP",            none,     none,     false,   3 },                          // 0x6A
+		{ "NOP",            none,     none,     false,   3 },                          // 0x6B
+		{ "NOP",            none,     none,     false,   3 },                          // 0x6C
+		{ "NOP",            none,     none,     false,   3 },                          // 0x6D
+		{ "NOP",            none,     none,     false,   3 },                          // 0x6E
+		{ "NOP",            none,     none,     false,   3 },                          // 0x6F
+		{ "JO {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x70
+		{ "JNO {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x71
+		{ "JC {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x72
+		{ "JNC {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x73
+		{ "JZ {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x74
+		{ "JNZ {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x75
+		{ "JNA {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x76
+		{ "JA {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x77
+		{ "JS {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x78
+		{ "JNS {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x79
+		{ "JP {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x7A
+		{ "JNP {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x7B
+		{ "JL {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x7C
+		{ "JNL {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x7D
+		{ "JLE {}{}",       rel8,     none,     false,   4, ConditionalJump },         // 0x7E
+		{ "JG {}{}",        rel8,     none,     false,   4, ConditionalJump },         // 0x7F
+		{ "GRP",            none,     none,     true,    4, NoBranch, NoPrefix, 0 },   // 0x80
+		{ "GRP",            none,     none,     true,    4, NoBranch, NoPrefix, 1 },   // 0x81
+		{ "GRP",            none,     none,     true,    4, NoBranch, NoPrefix, 2 },   // 0x82
+		{ "GRP",            none,     none,     true,    4, NoBranch, NoPrefix, 3 },   // 0x83
+		{ "TEST {}, {}",    rm8,      r8,       true,    3 },                          // 0x84
+		{ "TEST {}, {}",    rm16,     r16,      true,    3 },                          // 0x85
+		{ "XCHG {}, {}",    r8,       rm8,      true,    4 },                          // 0x86
+		{ "XCHG {}, {}",    r16,      rm16,     true,    4 },                          // 0x87
+		{ "MOV {}, {}",     rm8,      r8,       true,    2 },                          // 0x88
+		{ "MOV {}, {}",     rm16,     r16,      true,    2 },                          // 0x89
+		{ "MOV {}, {}",     r8,       rm8,      true,    2 },                          // 0x8A
+		{ "MOV {}, {}",     r16,      rm16,     true,    2 },                          // 0x8B
+		{ "GRP",            none,     none,     true,    2, NoBranch, NoPrefix, 4 },   // 0x8C
+		{ "LEA {}, {}",     r16,      rm16,     true,    2 },                          // 0x8D
+		{ "GRP",            none,     none,     true,    2, NoBranch, NoPrefix, 5 },   // 0x8E
+		{ "GRP",            none,     none,     true,    8, NoBranch, NoPrefix, 6 },   // 0x8F
+		{ "NOP",            none,     none,     false,   3 },                          // 0x90
+		{ "XCHG CX",        implied,  none,     false,   3 },                          // 0x91
+		{ "XCHG DX",        implied,  none,     false,   3 },                          // 0x92
+		{ "XCHG BX",        implied,  none,     false,   3 },                          // 0x93
+		{ "XCHG SP",        implied,  none,     false,   3 },                          // 0x94
+		{ "XCHG BP",        implied,  none,     false,   3 },                          // 0x95
+		{ "XCHG SI",        implied,  none,     false,   3 },                          // 0x96
+		{ "XCHG DI",        implied,  none,     false,   3 },                          // 0x97
+		{ "CBW",            none,     none,     false,   2 },                          // 0x98
+		{ "CWD",            none,     none,     false,   5 },                          // 0x99
+		{ "CALL {}{}",      segAddr,  none,     false,  28, Call },                    // 0x9A
+		{ "WAIT",           none,     none,     false,   3 },                          // 0x9B
+		{ "PUSHF",          none,     none,     false,  10 },                          // 0x9C
+		{ "POPF",           none,     none,     false,   8 },                          // 0x9D
+		{ "SAHF",           none,     none,     false,   4 },                          // 0x9E
+		{ "LAHF",           none,     none,     false,   4 },                          // 0x9F
+		{ "MOV AL, {}{}",   implied,  addr,     false,  10 },                          // 0xA0
+		{ "MOV AX, {}{}",   implied,  addr,     false,  10 },                          // 0xA1
+		{ "MOV {}{}, AL",   addr,     implied,  false,  10 },                          // 0xA2
+		{ "MOV {}{}, AX",   addr,     implied,  false,  10 },                          // 0xA3
+		{ "MOVSB",          none,     none,     false,  18 },                          // 0xA4
+		{ "MOVSW",          none,     none,     false,  18 },                          // 0xA5
+		{ "CMPSB",          none,     none,     false,  22 },                          // 0xA6
+		{ "CMPSW",          none,     none,     false,  22 },                          // 0xA7
+		{ "TEST AL, {}{}",  implied,  i8,       false,   4 },                          // 0xA8
+		{ "TEST AX, {}{}",  implied,  i16,      false,   4 },                          // 0xA9
+		{ "STOSB",          none,     none,     false,  11 },                          // 0xAA
+		{ "STOSW",          none,     none,     false,  11 },                          // 0xAB
+		{ "LODSB",          none,     none,     false,  12 },                          // 0xAC
+		{ "LODSW",          none,     none,     false,  12 },                          // 0xAD
+		{ "SCASB",          none,     none,     false,  15 },                          // 0xAE
+		{ "SCASW",          none,     none,     false,  15 },                          // 0xAF
+		{ "MOV AL, {}{}",   implied,  i8,       false,   4 },                          // 0xB0
+		{ "MOV CL, {}{}",   implied,  i8,       false,   4 },                          // 0xB1
+		{ "MOV DL, {}{}",   implied,  i8,       false,   4 },                          // 0xB2
+		{ "MOV BL, {}{}",   implied,  i8,       false,   4 },                          // 0xB3
+		{ "MOV AH, {}{}",   implied,  i8,       false,   4 },                          // 0xB4
+		{ "MOV CH, {}{}",   implied,  i8,       false,   4 },                          // 0xB5
+		{ "MOV DH, {}{}",   implied,  i8,       false,   4 },                          // 0xB6
+		{ "MOV BH, {}{}",   implied,  i8,       false,   4 },                          // 0xB7
+		{ "MOV AX, {}{}",   implied,  i16,      false,   4 },                          // 0xB8
+		{ "MOV CX, {}{}",   implied,  i16,      false,   4 },                          // 0xB9
+		{ "MOV DX, {}{}",   implied,  i16,      false,   4 },                          // 0xBA
+		{ "MOV BX, {}{}",   implied,  i16,      false,   4 },                          // 0xBB
+		{ "MOV SP, {}{}",   implied,  i16,      false,   4 },                          // 0xBC
+		{ "MOV BP, {}{}",   implied,  i16,      false,   4 },                          // 0xBD
+		{ "MOV SI, {}{}",   implied,  i16,      false,   4 },                          // 0xBE
+		{ "MOV DI, {}{}",   implied,  i16,      false,   4 },                          // 0xBF
+		{ "NOP",            none,     none,     false,   3 },                          // 0xC0
+		{ "NOP",            none,     none,     false,   3 },                          // 0xC1
+		{ "RET {}{}",       i16,      none,     false,  12, Return },                  // 0xC2
+		{ "RET",            none,     none,     false,   8, Return },                  // 0xC3
+		{ "LES {}, {}",     r16,      rm16,     true,   16 },                          // 0xC4
+		{ "LDS {}, {}",     r16,      rm16,     true,   16 },                          // 0xC5
+		{ "GRP",            none,     none,     true,    4, NoBranch, NoPrefix, 7 },   // 0xC6
+		{ "GRP",            none,     none,     true,    4, NoBranch, NoPrefix, 8 },   // 0xC7
+		{ "NOP",            none,     none,     false,   3 },                          // 0xC8
+		{ "NOP",            none,     none,     false,   3 },                          // 0xC9
+		{ "RETF {}{}",      i16,      none,     false,  17, Return },                  // 0xCA
+		{ "RETF",           none,     none,     false,  18, Return },                  // 0xCB
+		{ "INT 3",          implied,  none,     false,  52, Interrupt },               // 0xCC
+		{ "INT {}{}",       i8,       none,     false,  51, Interrupt },               // 0xCD
+		{ "INTO",           none,     none,     false,   4, Interrupt },               // 0xCE
+		{ "IRET",           none,     none,     false,  24, InterruptReturn },         // 0xCF
+		{ "GRP",            none,     none,     true,    2, NoBranch, NoPrefix, 9 },   // 0xD0
+		{ "GRP",            none,     none,     true,    2, NoBranch, NoPrefix, 10 },  // 0xD1
+		{ "GRP",            none,     none,     true,    8, NoBranch, NoPrefix, 11 },  // 0xD2
+		{ "GRP",            none,     none,     true,    8, NoBranch, NoPrefix, 12 },  // 0xD3
+		{ "AAM",            none,     none,     false,  83 },                          // 0xD4
+		{ "AAD",            none,     none,     false,  60 },                          // 0xD5
+		{ "NOP",            none,     none,     false,   3 },                          // 0xD6
+		{ "XLAT",           none,     none,     false,  11 },                          // 0xD7
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xD8
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xD9
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xDA
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xDB
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xDC
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xDD
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xDE
+		{ "ESC {}",         rm16,     none,     true,    2 },                          // 0xDF
+		{ "LOOPNZ {}{}",    rel8,     none,     false,   5, ConditionalJump },         // 0xE0
+		{ "LOOPZ {}{}",     rel8,     none,     false,   6, ConditionalJump },         // 0xE1
+		{ "LOOP {}{}",      rel8,     none,     false,   5, ConditionalJump },         // 0xE2
+		{ "JCXZ {}{}",      rel8,     implied,  false,   6, ConditionalJump },         // 0xE3
+		{ "IN AL, {}{}",    implied,  i8,       false,  10 },                          // 0xE4
+		{ "IN AX, {}{}",    implied,  i8,       false,  10 },                          // 0xE5
+		{ "OUT {}, AL",     i8,       implied,  false,  10 },                          // 0xE6
+		{ "OUT {}, AX",     i8,       implied,  false,  10 },                          // 0xE7
+		{ "CALL {}",        rel16,    none,     false,  19, Call },                    // 0xE8
+		{ "JMP {}",         rel16,    none,     false,  15, Jump },                    // 0xE9
+		{ "JMP {}{}",       segAddr,  none,     false,  15, Jump },                    // 0xEA
+		{ "JMP {}{}",       rel8,     none,     false,  15, Jump },                    // 0xEB
+		{ "IN AL, DX",      implied,  implied,  false,   8 },                          // 0xEC
+		{ "IN AX, DX",      implied,  implied,  false,   8 },                          // 0xED
+		{ "OUT DX, AL",     implied,  implied,  false,   8 },                          // 0xEE
+		{ "OUT DX, AX",     implied,  implied,  false,   8 },                          // 0xEF
+		{ "LOCK",           none,     none,     false,   2, NoBranch, LockPrefix },    // 0xF0
+		{ "NOP",            none,     none,     false,   3 },                          // 0xF1
+		{ "REPNZ",          none,     none,     false,   2, NoBranch, RepeatPrefix },  // 0xF2
+		{ "REP",            none,     none,     false,   2, NoBranch, RepeatPrefix },  // 0xF3
+		{ "HLT",            none,     none,     false,   2, Halt },                    // 0xF4
+		{ "CMC",            none,     none,     false,   2 },                          // 0xF5
+		{ "GRP",            none,     none,     true,    3, NoBranch, NoPrefix, 13 },  // 0xF6
+		{ "GRP",            none,     none,     true,    3, NoBranch, NoPrefix, 14 },  // 0xF7
+		{ "CLC",            none,     none,     false,   2 },                          // 0xF8
+		{ "STC",            none,     none,     false,   2 },                          // 0xF9
+		{ "CLI",            none,     none,     false,   2 },                          // 0xFA
+		{ "STI",            none,     none,     false,   2 },                          // 0xFB
+		{ "CLD",            none,     none,     false,   2 },                          // 0xFC
+		{ "STD",            none,     none,     false,   2 },                          // 0xFD
+		{ "GRP",            none,     none,     true,    3, NoBranch, NoPrefix, 15 },  // 0xFE
+		{ "GRP",            none,     none,     true,    3, NoBranch, NoPrefix, 16 }   // 0xFF
+	}};
+
+	constexpr std::array<const OpcodeInfo, 136> GroupTable =
+	{{
+		{ "ADD {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /0
+		{ "OR {}, {}",      rm8,      i8,       true,    4 },       // 0x80 /1
+		{ "ADC {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /2
+		{ "SBB {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /3
+		{ "AND {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /4
+		{ "SUB {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /5
+		{ "XOR {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /6
+		{ "CMP {}, {}",     rm8,      i8,       true,    4 },       // 0x80 /7
+		{ "ADD {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /0
+		{ "OR {}, {}",      rm16,     i16,      true,    4 },       // 0x81 /1
+		{ "ADC {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /2
+		{ "SBB {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /3
+		{ "AND {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /4
+		{ "SUB {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /5
+		{ "XOR {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /6
+		{ "CMP {}, {}",     rm16,     i16,      true,    4 },       // 0x81 /7
+		{ "ADD {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /0
+		{ "OR {}, {}",      rm8,      i8,       true,    4 },       // 0x82 /1
+		{ "ADC {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /2
+		{ "SBB {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /3
+		{ "AND {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /4
+		{ "SUB {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /5
+		{ "XOR {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /6
+		{ "CMP {}, {}",     rm8,      i8,       true,    4 },       // 0x82 /7
+		{ "ADD {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /0
+		{ "OR {}, {}",      rm16,     se8,      true,    4 },       // 0x83 /1
+		{ "ADC {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /2
+		{ "SBB {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /3
+		{ "AND {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /4
+		{ "SUB {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /5
+		{ "XOR {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /6
+		{ "CMP {}, {}",     rm16,     se8,      true,    4 },       // 0x83 /7
+		{ "MOV {}, ES",     rm16,     implied,  true,    2 },       // 0x8C /0
+		{ "MOV {}, CS",     rm16,     implied,  true,    2 },       // 0x8C /1
+		{ "MOV {}, SS",     rm16,     implied,  true,    2 },       // 0x8C /2
+		{ "MOV {}, DS",     rm16,     implied,  true,    2 },       // 0x8C /3
+		{ "NOP",            none,     none,     true,    3 },       // 0x8C /4
+		{ "NOP",            none,     none,     true,    3 },       // 0x8C /5
+		{ "NOP",            none,     none,     true,    3 },       // 0x8C /6
+		{ "NOP",            none,     none,     true,    3 },       // 0x8C /7
+		{ "MOV ES, {}{}",   implied,  rm16,     true,    2 },       // 0x8E /0
+		{ "MOV CS, {}{}",   implied,  rm16,     true,    2 },       // 0x8E /1
+		{ "MOV SS, {}{}",   implied,  rm16,     true,    2 },       // 0x8E /2
+		{ "MOV DS, {}{}",   implied,  rm16,     true,    2 },       // 0x8E /3
+		{ "NOP",            none,     none,     true,    3 },       // 0x8E /4
+		{ "NOP",            none,     none,     true,    3 },       // 0x8E /5
+		{ "NOP",            none,     none,     true,    3 },       // 0x8E /6
+		{ "NOP",            none,     none,     true,    3 },       // 0x8E /7
+		{ "POP {}",         rm16,     none,     true,    8 },       // 0x8F /0
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /1
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /2
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /3
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /4
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /5
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /6
+		{ "NOP",            none,     none,     true,    3 },       // 0x8F /7
+		{ "MOV {}, {}",     rm8,      i8,       true,    4 },       // 0xC6 /0
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /1
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /2
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /3
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /4
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /6
+		{ "NOP",            none,     none,     true,    3 },       // 0xC6 /7
+		{ "MOV {}, {}",     rm16,     i16,      true,    4 },       // 0xC7 /0
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /1
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /2
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /3
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /4
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /6
+		{ "NOP",            none,     none,     true,    3 },       // 0xC7 /7
+		{ "ROL {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /0
+		{ "ROR {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /1
+		{ "RCL {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /2
+		{ "RCR {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /3
+		{ "SHL {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /4
+		{ "SHR {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xD0 /6
+		{ "SAR {}, 1",      rm8,      implied,  true,    2 },       // 0xD0 /7
+		{ "ROL {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /0
+		{ "ROR {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /1
+		{ "RCL {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /2
+		{ "RCR {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /3
+		{ "SHL {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /4
+		{ "SHR {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xD1 /6
+		{ "SAR {}, 1",      rm16,     implied,  true,    2 },       // 0xD1 /7
+		{ "ROL {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /0
+		{ "ROR {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /1
+		{ "RCL {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /2
+		{ "RCR {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /3
+		{ "SHL {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /4
+		{ "SHR {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xD2 /6
+		{ "SAR {}, CL",     rm8,      implied,  true,    8 },       // 0xD2 /7
+		{ "ROL {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /0
+		{ "ROR {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /1
+		{ "RCL {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /2
+		{ "RCR {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /3
+		{ "SHL {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /4
+		{ "SHR {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xD3 /6
+		{ "SAR {}, CL",     rm16,     implied,  true,    8 },       // 0xD3 /7
+		{ "TEST {}, {}",    rm8,      i8,       true,    5 },       // 0xF6 /0
+		{ "NOP",            none,     none,     true,    3 },       // 0xF6 /1
+		{ "NOT {}",         rm8,      none,     true,    3 },       // 0xF6 /2
+		{ "NEG {}",         rm8,      none,     true,    3 },       // 0xF6 /3
+		{ "MUL {}",         rm8,      none,     true,   70 },       // 0xF6 /4
+		{ "IMUL {}",        rm8,      none,     true,   80 },       // 0xF6 /5
+		{ "DIV {}",         rm8,      none,     true,   80 },       // 0xF6 /6
+		{ "IDIV {}",        rm8,      none,     true,  101 },       // 0xF6 /7
+		{ "TEST {}, {}",    rm16,     i16,      true,    5 },       // 0xF7 /0
+		{ "NOP",            none,     none,     true,    3 },       // 0xF7 /1
+		{ "NOT {}",         rm16,     none,     true,    3 },       // 0xF7 /2
+		{ "NEG {}",         rm16,     none,     true,    3 },       // 0xF7 /3
+		{ "MUL {}",         rm16,     none,     true,  118 },       // 0xF7 /4
+		{ "IMUL {}",        rm16,     none,     true,  128 },       // 0xF7 /5
+		{ "DIV {}",         rm16,     none,     true,  144 },       // 0xF7 /6
+		{ "IDIV {}",        rm16,     none,     true,  165 },       // 0xF7 /7
+		{ "INC {}",         rm8,      none,     true,    3 },       // 0xFE /0
+		{ "DEC {}",         rm8,      none,     true,    3 },       // 0xFE /1
+		{ "NOP",            none,     none,     true,    3 },       // 0xFE /2
+		{ "NOP",            none,     none,     true,    3 },       // 0xFE /3
+		{ "NOP",            none,     none,     true,    3 },       // 0xFE /4
+		{ "NOP",            none,     none,     true,    3 },       // 0xFE /5
+		{ "NOP",            none,     none,     true,    3 },       // 0xFE /6
+		{ "NOP",            none,     none,     true,    3 },       // 0xFE /7
+		{ "INC {}",         rm16,     none,     true,    2 },       // 0xFF /0
+		{ "DEC {}",         rm16,     none,     true,    2 },       // 0xFF /1
+		{ "CALL {}",        rm16,     none,     true,   16, Call }, // 0xFF /2
+		{ "CALL {}",        rm16,     none,     true,   37, Call }, // 0xFF /3
+		{ "JMP {}",         rm16,     none,     true,   11, Jump }, // 0xFF /4
+		{ "JMP {}",         rm16,     none,     true,   24, Jump }, // 0xFF /5
+		{ "PUSH {}",        rm16,     none,     true,   11 },       // 0xFF /6
+		{ "NOP",            none,     none,     true,    3 }        // 0xFF /7
+	}};
+
+	/**
+	 * @brief Entry of an opcode, resolved through its group when it has one.
+	 *
+	 * @param reg The reg field of the ModR/M byte, ignored for opcodes without a group.
+	 */
+	constexpr const OpcodeInfo& GetOpcodeInfo(u8 opcode, u8 reg)
+	{
+		const OpcodeInfo& info = OpcodeTable[opcode];
+
+		return (info.Group < 0) ? info : GroupTable[info.Group * 8 + (reg & 0x07)];
+	}
+
+	constexpr u8 GetOperandSize(OperandType type)
+	{
+		switch (type)
+		{
+		case rel8:
+		case se8:
+		case i8:
+			return 1;
+
+		case rel16:
+		case i16:
+		case addr:
+			return 2;
+
+		case segAddr:
+			return 4;
+
+		default:
+			return 0;
+		}
+	}
+
+	namespace detail
+	{
+
+		struct LengthInfo
+		{
+			u8 Base{};     // opcode, ModR/M and immediate bytes
+			u8 DispMask{}; // 0xFF if a r/m operand may add a displacement
+		};
+
+		constexpr auto MakeLengthTable()
+		{
+			std::array<std::array<LengthInfo, 8>, 256> table{};
+
+			for (u16 opcode = 0; opcode < 256; ++opcode)
+			{
+				for (u8 reg = 0; reg < 8; ++reg)
+				{
+					const OpcodeInfo& info = GetOpcodeInfo(static_cast<u8>(opcode), reg);
+
+					const bool hasRm = info.Operand1 == rm8 || info.Operand1 == rm16 || info.Operand2 == rm8 || info.Operand2 == rm16;
+
+					table[opcode][reg].Base = static_cast<u8>(1 + OpcodeTable[opcode].HasModRM + GetOperandSize(info.Operand1) + GetOperandSize(info.Operand2));
+					table[opcode][reg].DispMask = hasRm ? 0xFF : 0x00;
+				}
+			}
+
+			return table;
+		}
+
+		constexpr auto MakeDisplacementTable()
+		{
+			std::array<u8, 256> table{};
+
+			for (u16 modrm = 0; modrm < 256; ++modrm)
+			{
+				const u8 mod = modrm >> 6;
+				const u8 rm = modrm & 0x07;
+
+				table[modrm] = (mod == 1) ? 1 : (mod == 2 || (mod == 0 && rm == 6)) ? 2 : 0;
+			}
+
+			return table;
+		}
+
+		constexpr auto LengthTable = MakeLengthTable();
+		constexpr auto DisplacementTable = MakeDisplacementTable();
+
+	} // namespace detail
+
+	/**
+	 * @brief Length of an instruction from its first two bytes, without branches.
+	 *
+	 * @details
+	 * The second byte is only used when the opcode has a ModR/M byte, pass anything (e.g. 0)
+	 * when there is none. Prefixes count as one-byte instructions, as in the disassembler.
+	 */
+	constexpr u8 GetInstructionLength(u8 opcode, u8 modrm)
+	{
+		const detail::LengthInfo info = detail::LengthTable[opcode][(modrm >> 3) & 0x07];
+
+		return info.Base + (detail::DisplacementTable[modrm] & info.DispMask);
+	}
+
+	static_assert(GetInstructionLength(0x90, 0x00) == 1);
+	static_assert(GetInstructionLength(0x81, 0x87) == 6); // ADD WORD PTR [BX + disp16], imm16
+	static_assert(GetInstructionLength(0xF6, 0x46) == 4); // TEST BYTE PTR [BP + disp8], imm8
+	static_assert(GetInstructionLength(0xF6, 0x5E) == 3); // NEG BYTE PTR [BP + disp8]
+	static_assert(GetInstructionLength(0xEA, 0x00) == 5); // JMP seg:off
+	static_assert(GetInstructionLength(0xD8, 0x06) == 4); // ESC [disp16]
+
+} // namespace i8086
@@ -7,6 +7,8 @@
 #include <Utils/types.hpp>
 
 #include <vector>
+#include <span>
+#include <cstring>
 #include <stdexcept>
 
 namespace i8086
@@ -39,6 +41,32 @@ namespace i8086
 			return mMemory[address];
 		}
 
+		void WriteBlock(u32 address, std::span<const u8> data)
+		{
+			if (address > mMemorySize || data.size() > mMemorySize - address)
+			{
+				throw std::runtime_error("RAM::WriteBlock -> Trying to write to an invalid address range");
+			}
+
+			if (!data.empty())
+			{
+				std::memcpy(mMemory.data() + address, data.data(), data.size());
+			}
+		}
+
+		void ReadBlock(u32 address, std::span<u8> buffer) const
+		{
+			if (address > mMemorySize || buffer.size() > mMemorySize - address)
+			{
+				throw std::runtime_error("RAM::ReadBlock -> Trying to read from an invalid address range");
+			}
+
+			if (!buffer.empty())
+			{
+				std::memcpy(buffer.data(), mMemory.data() + address, buffer.size());
+			}
+		}
+
 		const std::vector<u8>& GetMemory() const
 		{
 			return mMemory;
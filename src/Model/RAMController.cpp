@@ -15,12 +15,12 @@ namespace i8086
 
 		if (size == 8)
 		{
-			mRAM->Write(address, data & 0xFF);
+			mRAM->Write(mBaseAddress + address, data & 0xFF);
 			return;
 		}
 
-		mRAM->Write(address, data & 0xFF);
-		mRAM->Write(address + 1, (data >> 8) & 0xFF);
+		mRAM->Write(mBaseAddress + address, data & 0xFF);
+		mRAM->Write(mBaseAddress + address + 1, (data >> 8) & 0xFF);
 	}
 
 	u16 RAMController::Read(u32 address, u8 size) const
@@ -28,15 +28,25 @@ namespace i8086
 
 		if (size == 8)
 		{
-			return mRAM->Read(address);
+			return mRAM->Read(mBaseAddress + address);
 		}
 
-		return static_cast<u16>(mRAM->Read(address + 1) << 8) | mRAM->Read(address);
+		return static_cast<u16>(mRAM->Read(mBaseAddress + address + 1) << 8) | mRAM->Read(mBaseAddress + address);
 	}
 
+    void RAMController::ReadBlock(u32 address, std::span<u8> buffer) const
+    {
+        mRAM->ReadBlock(mBaseAddress + address, buffer);
+    }
+
+    void RAMController::WriteBlock(u32 address, std::span<const u8> data)
+    {
+        mRAM->WriteBlock(mBaseAddress + address, data);
+    }
+
     size_t RAMController::GetSize() const
     {
-        return mRAM->GetSize();
+        return mSize;
     }
 
     void RAMController::LoadFile(const std::string& filepath, u32 address) const
@@ -52,15 +62,19 @@ namespace i8086
         size_t fileSize = file.tellg();
         file.seekg(0, std::ios_base::beg);
 
-        if (fileSize + address > mRAM->GetSize())
+        if (fileSize + address > GetSize())
         {
             throw std::runtime_error("RAMController::LoadFile -> File is too large to fit in memory from the given address");
         }
 
-        for (size_t i = 0; i < fileSize; ++i)
+        std::vector<u8> buffer(fileSize);
+
+        if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize))
         {
-            mRAM->Write(address + i, file.get());
+            throw std::runtime_error("RAMController::LoadFile -> Failed to read the file");
         }
+
+        mRAM->WriteBlock(mBaseAddress + address, buffer);
     }
     
 } // namespace i8086
\ No newline at end of file
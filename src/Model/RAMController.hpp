@@ -0,0 +1,52 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "Register.hpp"
+#include "RAM.hpp"
+#include <Interfaces/IMemoryDevice.hpp>
+
+#include <string>
+#include <vector>
+
+namespace i8086
+{
+    class RAMController : public IMemoryDevice
+    {
+
+    public:
+
+        /**
+         * @param baseAddress Offset into the RAM of the controller's first byte, lets the same
+         * RAM be mapped in several windows around memory-mapped devices.
+         * @param size Bytes of the window, 0 for the rest of the RAM from baseAddress.
+         */
+        RAMController(RAM* const ram, u32 baseAddress = 0, size_t size = 0)
+            : mRAM(ram), mBaseAddress(baseAddress), mSize(size ? size : ram->GetSize() - baseAddress) {}
+
+        void Write(u32 address, u16 data, u8 size) override;
+        u16 Read(u32 address, u8 size) const override;
+
+        void ReadBlock(u32 address, std::span<u8> buffer) const override;
+        void WriteBlock(u32 address, std::span<const u8> data) override;
+
+        size_t GetSize() const override;
+
+        void LoadFile(const std::string& filepath, u32 address) const;
+
+        const std::vector<u8>& GetMemory() const
+		{
+			return mRAM->GetMemory();
+		}
+
+    private:
+
+        RAM* const mRAM;
+        const u32 mBaseAddress;
+        const size_t mSize;
+
+    };
+
+} // namespace i8086
\ No newline at end of file
@@ -0,0 +1,48 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "Scheduler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace i8086
+{
+
+	u32 Scheduler::Schedule(u64 cycle, Callback callback)
+	{
+		if (!callback)
+		{
+			throw std::runtime_error("Scheduler::Schedule -> Trying to schedule an empty callback");
+		}
+
+		const u32 id = mNextId++;
+
+		// events due at the same cycle run in the order they were scheduled
+		const auto it = std::upper_bound(mEvents.begin(), mEvents.end(), cycle,
+			[](u64 value, const Event& event) { return value < event.Cycle; });
+
+		mEvents.insert(it, { cycle, id, std::move(callback) });
+
+		return id;
+	}
+
+	void Scheduler::Cancel(u32 id)
+	{
+		std::erase_if(mEvents, [id](const Event& event) { return event.Id == id; });
+	}
+
+	void Scheduler::RunDueEvents(u64 currentCycle)
+	{
+		// callbacks may schedule new events, so the front is re-read on every iteration
+		while (!mEvents.empty() && mEvents.front().Cycle <= currentCycle)
+		{
+			Callback callback = std::move(mEvents.front().Function);
+			mEvents.erase(mEvents.begin());
+
+			callback();
+		}
+	}
+
+} // namespace i8086
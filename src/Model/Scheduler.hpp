@@ -0,0 +1,57 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace i8086
+{
+
+	/**
+	 * @brief Queue of device events keyed by the CPU cycle they are due at.
+	 *
+	 * @details
+	 * Devices schedule callbacks instead of being polled every instruction. The CPU checks
+	 * the earliest due cycle once per instruction and, while halted, jumps its cycle
+	 * counter straight to it. Only a handful of events are ever pending, so a vector kept
+	 * sorted by due cycle is enough.
+	 */
+	class Scheduler
+	{
+
+	public:
+
+		using Callback = std::function<void()>;
+
+		static constexpr u64 NO_EVENT = std::numeric_limits<u64>::max();
+
+		u32 Schedule(u64 cycle, Callback callback);
+		void Cancel(u32 id);
+
+		void RunDueEvents(u64 currentCycle);
+
+		u64 GetNextEventCycle() const
+		{
+			return mEvents.empty() ? NO_EVENT : mEvents.front().Cycle;
+		}
+
+	private:
+
+		struct Event
+		{
+			u64 Cycle{};
+			u32 Id{};
+			Callback Function;
+		};
+
+		std::vector<Event> mEvents;
+		u32 mNextId{ 1 };
+	};
+
+} // namespace i8086
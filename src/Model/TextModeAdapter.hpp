@@ -0,0 +1,86 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Interfaces/IMemoryDevice.hpp>
+#include <Utils/types.hpp>
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+namespace i8086
+{
+
+	enum class TextMode
+	{
+		MDA, // 4 KiB monochrome buffer at 0xB0000
+		CGA  // 16 KiB color buffer at 0xB8000
+	};
+
+	/**
+	 * @brief 80x25 text-mode video adapter (MDA/CGA character buffer).
+	 *
+	 * @details
+	 * Each cell is a character byte followed by an attribute byte. Bus writes that change
+	 * a visible cell mark its row as dirty, so views only need to rebuild the rows
+	 * returned by ConsumeDirtyRows() instead of the whole screen every frame.
+	 */
+	class TextModeAdapter : public IMemoryDevice
+	{
+
+	public:
+
+		static constexpr u32 COLUMNS = 80;
+		static constexpr u32 ROWS = 25;
+
+		TextModeAdapter(TextMode mode = TextMode::CGA);
+
+		void Write(u32 address, u16 data, u8 size) override;
+		u16 Read(u32 address, u8 size) const override;
+
+		void ReadBlock(u32 address, std::span<u8> buffer) const override;
+		void WriteBlock(u32 address, std::span<const u8> data) override;
+
+		size_t GetSize() const override { return mVRAM.size(); }
+
+		TextMode GetMode() const { return mMode; }
+		u32 GetBaseAddress() const;
+		u32 GetEndAddress() const { return GetBaseAddress() + static_cast<u32>(mVRAM.size()) - 1; }
+
+		u8 GetCharacter(u32 row, u32 column) const { return mVRAM[(row * COLUMNS + column) * 2]; }
+		u8 GetAttribute(u32 row, u32 column) const { return mVRAM[(row * COLUMNS + column) * 2 + 1]; }
+
+		/**
+		 * @brief Returns the rows modified since the last call (bit n = row n) and clears them.
+		 */
+		u32 ConsumeDirtyRows();
+		void MarkAllDirty() { mDirtyRows = ALL_ROWS; }
+
+		/**
+		 * @brief Writes the screen contents as UTF-8 text, one line per row.
+		 */
+		void DumpText(std::ostream& out) const;
+
+		/**
+		 * @brief Encodes a code page 437 glyph as UTF-8.
+		 *
+		 * @return The number of bytes written to out (1 to 3).
+		 */
+		static size_t GlyphToUTF8(u8 glyph, char out[4]);
+
+	private:
+
+		static constexpr u32 ALL_ROWS = (1u << ROWS) - 1;
+		static constexpr u32 VISIBLE_BYTES = COLUMNS * ROWS * 2;
+
+		inline void StoreByte(u32 address, u8 value);
+
+		const TextMode mMode;
+		std::vector<u8> mVRAM;
+		u32 mDirtyRows{ ALL_ROWS };
+	};
+
+} // namespace i8086
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <Utils/types.hpp>
+
 #include <string>
+#include <string_view>
+#include <span>
+#include <vector>
 
 namespace disassembler
 {
@@ -24,13 +29,86 @@ namespace disassembler
 		tMinus
 	};
 
+	/**
+	 * @brief A token of a disassembled line, its text is stored in a TokenArena.
+	 */
 	struct Token
 	{
-		Token(const std::string& token, const TokenType& type, bool hasSpace = false) : token(token), type(type), hasSpace(hasSpace) {}
+		u32 Offset{};
+		u8 Length{};
+		TokenType Type{ tUnknown };
+		bool HasSpace{ false };
+	};
+
+	/**
+	 * @brief Range of tokens of a single instruction inside a TokenArena.
+	 */
+	struct TokenSpan
+	{
+		u32 First{};
+		u16 Count{};
+	};
+
+	/**
+	 * @brief Shared storage for the tokens of many instructions.
+	 *
+	 * @details
+	 * Token text is appended to one character buffer and tokens refer to it by offset, so
+	 * formatting a listing does not allocate per token. Clear() keeps the capacity, a
+	 * reused arena stops allocating once it has grown to the listing size.
+	 */
+	class TokenArena
+	{
+
+	public:
+
+		void Clear()
+		{
+			mText.clear();
+			mTokens.clear();
+		}
+
+		u32 GetTokenCount() const
+		{
+			return static_cast<u32>(mTokens.size());
+		}
+
+		void Push(std::string_view text, TokenType type, bool hasSpace = false)
+		{
+			mTokens.push_back({ static_cast<u32>(mText.size()), static_cast<u8>(text.size()), type, hasSpace });
+			mText.insert(mText.end(), text.begin(), text.end());
+		}
+
+		/**
+		 * @brief Appends the tokens of another arena, their spans move up by the previous token count.
+		 */
+		void Append(const TokenArena& other)
+		{
+			const u32 textBase = static_cast<u32>(mText.size());
+
+			mText.insert(mText.end(), other.mText.begin(), other.mText.end());
+
+			for (Token token : other.mTokens)
+			{
+				token.Offset += textBase;
+				mTokens.push_back(token);
+			}
+		}
+
+		std::span<const Token> GetTokens(const TokenSpan& span) const
+		{
+			return { mTokens.data() + span.First, span.Count };
+		}
+
+		std::string_view GetText(const Token& token) const
+		{
+			return { mText.data() + token.Offset, token.Length };
+		}
+
+	private:
 
-		const std::string token;
-		const TokenType type;
-		bool hasSpace;
+		std::vector<char> mText;
+		std::vector<Token> mTokens;
 	};
 
 	static const std::string TokenTypeToString(const TokenType& type) {
@@ -0,0 +1,30 @@
+# Lists INPUT without and with --jobs, fails if the listings differ.
+#
+# cmake -DI86DIS=<i86dis> -DINPUT=<file> -DOUTPUT_DIR=<dir> [-DARGS=<options>] -P CompareListings.cmake
+
+separate_arguments(ARGS)
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+set(SWEEP "${OUTPUT_DIR}/sweep.lst")
+set(PARALLEL "${OUTPUT_DIR}/parallel.lst")
+
+execute_process(COMMAND "${I86DIS}" ${ARGS} -o "${SWEEP}" "${INPUT}" RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "i86dis failed: ${result}")
+endif()
+
+foreach(jobs 1 4)
+    execute_process(COMMAND "${I86DIS}" ${ARGS} --jobs ${jobs} -o "${PARALLEL}" "${INPUT}" RESULT_VARIABLE result)
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "i86dis --jobs ${jobs} failed: ${result}")
+    endif()
+
+    execute_process(COMMAND "${CMAKE_COMMAND}" -E compare_files "${SWEEP}" "${PARALLEL}" RESULT_VARIABLE result)
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "i86dis --jobs ${jobs} differs from the streaming listing (${ARGS})")
+    endif()
+endforeach()
@@ -0,0 +1,121 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+// A guest halted with interrupts enabled wakes on the next timer tick: its cycle counter
+// jumps straight to the tick, IRQ0 runs the INT 08h handler and execution resumes after HLT.
+
+#include <Model/I8086.hpp>
+#include <Model/IntervalTimer.hpp>
+#include <Model/IOBus.hpp>
+#include <Model/MemoryBus.hpp>
+#include <Model/RAMController.hpp>
+#include <Model/Scheduler.hpp>
+
+#include <array>
+#include <cstdio>
+
+namespace
+{
+
+	using namespace i8086;
+
+	int failures = 0;
+
+	void Check(bool condition, const char* what)
+	{
+		if (!condition)
+		{
+			std::fprintf(stderr, "FAILED: %s\n", what);
+			++failures;
+		}
+	}
+
+	u16 GetSI(const I8086& cpu)
+	{
+		CPUState state;
+		cpu.GetInternalState(state);
+
+		return state.SI.X;
+	}
+
+} // namespace
+
+int main()
+{
+	RAM ram(0x10000);
+	RAMController ramController(&ram);
+	MemoryBus bus;
+	IO::IOBus ioBus;
+	Scheduler scheduler;
+
+	bus.AttachDevice(&ramController, 0x0000, 0xFFFF);
+
+	I8086 cpu(&bus, &ioBus, &scheduler);
+	IntervalTimer timer(&cpu, &scheduler);
+
+	ioBus.AttachDevice(&timer);
+
+	// 0000: STI, HLT, JMP to the HLT
+	constexpr std::array<u8, 4> program = { 0xFB, 0xF4, 0xEB, 0xFD };
+
+	// INT 08h -> 0000:0040, which only counts its calls in SI and returns
+	constexpr std::array<u8, 4> vector = { 0x40, 0x00, 0x00, 0x00 };
+	constexpr std::array<u8, 2> handler = { 0x46, 0xCF }; // INC SI, IRET
+
+	bus.WriteBlock(0x0000, program);
+	bus.WriteBlock(IntervalTimer::IRQ0_VECTOR * 4, vector);
+	bus.WriteBlock(0x0040, handler);
+
+	const u64 period = timer.GetPeriod();
+
+	Check(period == 0x10000 * IntervalTimer::CLOCK_DIVIDER, "the default period is 65536 counter ticks");
+
+	// STI and HLT, then the CPU sleeps
+	cpu.Cycles(2);
+
+	Check(cpu.IsHalted(), "HLT halts the CPU");
+	Check(cpu.GetCycleCount() < period, "no tick is due yet");
+
+	// one call skips to the tick, services IRQ0 and runs the handler
+	cpu.Cycles(2);
+
+	Check(cpu.GetCycleCount() >= period, "the halted CPU skips to the tick");
+	Check(cpu.GetCycleCount() < period + 100, "the halted CPU stops at the tick");
+	Check(GetSI(cpu) == 1, "IRQ0 runs the INT 08h handler once");
+
+	// back after HLT, the JMP returns to it and the CPU halts until the following tick
+	cpu.Cycles(4);
+
+	Check(cpu.IsHalted(), "the guest halts again after the handler");
+
+	cpu.Cycles(2);
+
+	Check(cpu.GetCycleCount() >= 2 * period && cpu.GetCycleCount() < 2 * period + 100, "the next tick comes one period later");
+	Check(GetSI(cpu) == 2, "each tick runs the handler");
+
+	// the guest reprograms channel 0: control word, then the reload value low byte first
+	ioBus.Write(IntervalTimer::CONTROL_PORT, 0x36, 8);
+	ioBus.Write(IntervalTimer::CHANNEL0_PORT, 0x00, 8);
+	ioBus.Write(IntervalTimer::CHANNEL0_PORT, 0x10, 8);
+
+	Check(timer.GetPeriod() == 0x1000 * IntervalTimer::CLOCK_DIVIDER, "a written reload value sets the period");
+
+	// a latched count reads back low byte first, right after the reload it is the full count
+	ioBus.Write(IntervalTimer::CONTROL_PORT, 0x00, 8);
+
+	const u16 low = ioBus.Read(IntervalTimer::CHANNEL0_PORT, 8);
+	const u16 high = ioBus.Read(IntervalTimer::CHANNEL0_PORT, 8);
+
+	Check(((high << 8) | low) == 0x1000, "the latched count is the reload value");
+
+	const u64 reprogrammed = cpu.GetCycleCount();
+
+	// JMP and HLT, then the tick
+	cpu.Cycles(2);
+	cpu.Cycles(2);
+
+	Check(cpu.GetCycleCount() >= reprogrammed + timer.GetPeriod() && GetSI(cpu) == 3, "the new period applies from the reload");
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+// FindRow maps every address of a listing to the instruction containing it and the rest to
+// NOT_FOUND, and the listing stays within a small constant factor of the code it decodes.
+
+#include <Model/Disassembler.hpp>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+	using namespace disassembler;
+
+	int failures = 0;
+
+	void Check(bool condition, const char* what)
+	{
+		if (!condition)
+		{
+			std::fprintf(stderr, "FAILED: %s\n", what);
+			++failures;
+		}
+	}
+
+} // namespace
+
+int main()
+{
+	std::vector<u8> code(256 * 1024);
+	std::mt19937 random(8088);
+
+	for (auto& byte : code)
+	{
+		byte = static_cast<u8>(random());
+	}
+
+	constexpr u32 baseAddress = 0x20000;
+
+	Disassembler decoder;
+	decoder.Disassembly(code, baseAddress);
+
+	const Listing& listing = decoder.GetListing();
+	const u32 endAddress = listing.GetAddress(listing.Size() - 1) + listing.GetLength(listing.Size() - 1);
+
+	Check(listing.GetAddress(0) == baseAddress, "the listing starts at the base address");
+	Check(endAddress >= baseAddress + code.size(), "the listing covers the code");
+
+	bool everyAddressFound = true;
+
+	for (u32 address = baseAddress; address < endAddress; ++address)
+	{
+		const size_t row = listing.FindRow(address);
+
+		if (row == Listing::NOT_FOUND || address < listing.GetAddress(row) || address >= listing.GetAddress(row) + listing.GetLength(row))
+		{
+			everyAddressFound = false;
+		}
+	}
+
+	Check(everyAddressFound, "FindRow returns the instruction containing every address");
+	Check(listing.FindRow(baseAddress - 1) == Listing::NOT_FOUND, "FindRow before the listing");
+	Check(listing.FindRow(endAddress) == Listing::NOT_FOUND, "FindRow after the listing");
+
+	Check(listing.GetMemoryUsage() < 8 * code.size(), "memory use within 8 bytes per byte of code");
+
+	if (failures == 0)
+	{
+		std::puts("Listing: all checks passed");
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,89 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+// ParallelDisassembly lists random bytes row for row like Disassembly, whatever the thread
+// count and however many times the same decoder (and so the same worker threads) is reused.
+
+#include <Model/Disassembler.hpp>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+	using namespace disassembler;
+
+	int failures = 0;
+
+	void Check(bool condition, const std::string& what)
+	{
+		if (!condition)
+		{
+			std::fprintf(stderr, "FAILED: %s\n", what.c_str());
+			++failures;
+		}
+	}
+
+	bool IsSameListing(const Listing& expected, const Listing& actual)
+	{
+		if (expected.Size() != actual.Size())
+		{
+			return false;
+		}
+
+		for (size_t row = 0; row < expected.Size(); ++row)
+		{
+			const Instruction a = expected.Get(row);
+			const Instruction b = actual.Get(row);
+
+			if (a.Address != b.Address || a.Length != b.Length || a.Id != b.Id || a.Bytes != b.Bytes
+				|| a.Operands[0].Value != b.Operands[0].Value || a.Operands[1].Value != b.Operands[1].Value
+				|| a.Operands[0].Segment != b.Operands[0].Segment)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+} // namespace
+
+int main()
+{
+	// several minimum-size chunks, so every thread count below really splits the range
+	std::vector<u8> code(5 * Disassembler::PARALLEL_MIN_CHUNK_SIZE + 123);
+	std::mt19937 random(8086);
+
+	for (auto& byte : code)
+	{
+		byte = static_cast<u8>(random());
+	}
+
+	constexpr u32 baseAddress = 0x10000;
+
+	Disassembler sequential;
+	sequential.Disassembly(code, baseAddress);
+
+	Check(sequential.GetListing().Size() > code.size() / 6, "the sequential listing covers the code");
+
+	Disassembler parallel;
+
+	for (const unsigned threadCount : { 2u, 2u, 3u, 5u, 5u, 1u, 0u })
+	{
+		parallel.ParallelDisassembly(code, baseAddress, threadCount);
+
+		Check(IsSameListing(sequential.GetListing(), parallel.GetListing()), "same listing with " + std::to_string(threadCount) + " threads");
+	}
+
+	if (failures == 0)
+	{
+		std::puts("ParallelDisassembly: all checks passed");
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,842 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+// i86dis - command-line disassembler
+//
+// Disassembles a raw binary file, or a range of a memory image, to stdout in NASM-style
+// text or JSON lines. The input is read and decoded one block at a time, so memory use
+// does not depend on the input size.
+//
+// With --entry, only the code reached from the given entry points is decoded instead
+// (FlowAnalyzer), listed as basic blocks with their successors and cross-references.
+// That mode reads the whole range into memory.
+//
+// With --jobs or --targets, the whole range is read into memory and decoded at once into a
+// Listing, by several threads with --jobs (ParallelDisassembly). The listing is the same as
+// the streaming one; --targets also marks the branches that land inside an instruction,
+// looked up in the listing by address.
+
+#include <Model/Disassembler.hpp>
+#include <Model/FlowAnalyzer.hpp>
+#include <Utils/BufferedWriter.hpp>
+#include <Utils/types.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+	using disassembler::BasicBlock;
+	using disassembler::Disassembler;
+	using disassembler::FlowAnalyzer;
+	using disassembler::FlowEdge;
+	using disassembler::FlowKind;
+	using disassembler::Instruction;
+	using disassembler::Listing;
+	using disassembler::TokenArena;
+
+	enum class OutputFormat
+	{
+		Text,
+		Json
+	};
+
+	struct EntryPoint
+	{
+		u16 Segment{};
+		u16 Offset{};
+	};
+
+	struct Options
+	{
+		std::string InputPath;
+		std::string OutputPath;
+		OutputFormat Format{ OutputFormat::Text };
+		u32 BaseAddress{ 0 };   // address the first byte of the file is loaded at
+		u32 StartAddress{ 0 };
+		u32 EndAddress{ 0 };    // 0 up to the end of the file
+		std::vector<EntryPoint> EntryPoints; // empty for a linear sweep
+		std::optional<unsigned> Jobs;        // threads of a whole-range sweep, 0 all cores
+		bool MarkTargets{ false };           // whole-range sweep marking branches into instructions
+	};
+
+	constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+	struct FileCloser
+	{
+		void operator()(std::FILE* file) const { std::fclose(file); }
+	};
+
+	using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+	void PrintUsage()
+	{
+		std::fputs(
+			"usage: i86dis [options] <file>\n"
+			"\n"
+			"  -f, --format text|json  output NASM-style text (default) or JSON lines\n"
+			"  -b, --base <address>    address the file is loaded at (default 0, 0x100 for a .COM)\n"
+			"  -s, --start <address>   first address to disassemble (default: base)\n"
+			"  -e, --end <address>     address to stop at (default: end of the file)\n"
+			"  -x, --entry <seg:off>   follow the code reached from seg:off and list it as basic\n"
+			"                          blocks with cross-references, may be given more than once\n"
+			"  -j, --jobs <n>          read the whole range and decode it on n threads (0: all cores)\n"
+			"  -t, --targets           read the whole range and mark the branches that land inside\n"
+			"                          an instruction\n"
+			"  -o, --output <file>     write to file instead of stdout\n"
+			"\n"
+			"Addresses are decimal or 0x-prefixed hexadecimal, seg:off is hexadecimal.\n",
+			stderr);
+	}
+
+	u32 ParseAddress(std::string_view option, const char* text)
+	{
+		try
+		{
+			size_t used = 0;
+			const unsigned long value = std::stoul(text, &used, 0);
+
+			if (used == std::strlen(text) && value <= 0xFFFFFFFFul)
+			{
+				return static_cast<u32>(value);
+			}
+		}
+
+		catch (const std::logic_error&)
+		{
+		}
+
+		throw std::runtime_error("Invalid address for " + std::string(option) + ": " + text);
+	}
+
+	unsigned ParseJobs(std::string_view option, const char* text)
+	{
+		try
+		{
+			size_t used = 0;
+			const unsigned long value = std::stoul(text, &used, 10);
+
+			if (used == std::strlen(text) && value <= 256)
+			{
+				return static_cast<unsigned>(value);
+			}
+		}
+
+		catch (const std::logic_error&)
+		{
+		}
+
+		throw std::runtime_error("Invalid thread count for " + std::string(option) + ": " + text);
+	}
+
+	EntryPoint ParseEntryPoint(std::string_view option, const char* text)
+	{
+		const char* colon = std::strchr(text, ':');
+
+		try
+		{
+			if (colon != nullptr)
+			{
+				size_t segmentUsed = 0;
+				size_t offsetUsed = 0;
+
+				const std::string segment(text, colon);
+				const unsigned long segmentValue = std::stoul(segment, &segmentUsed, 16);
+				const unsigned long offsetValue = std::stoul(colon + 1, &offsetUsed, 16);
+
+				if (segmentUsed == segment.size() && offsetUsed == std::strlen(colon + 1) && segmentValue <= 0xFFFF && offsetValue <= 0xFFFF)
+				{
+					return { static_cast<u16>(segmentValue), static_cast<u16>(offsetValue) };
+				}
+			}
+		}
+
+		catch (const std::logic_error&)
+		{
+		}
+
+		throw std::runtime_error("Invalid seg:off for " + std::string(option) + ": " + text);
+	}
+
+	Options ParseOptions(int argc, char** argv)
+	{
+		Options options;
+		bool hasStart = false;
+
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+
+			auto value = [&]() -> const char*
+			{
+				if (i + 1 >= argc)
+				{
+					throw std::runtime_error("Missing value for " + std::string(arg));
+				}
+
+				return argv[++i];
+			};
+
+			if (arg == "-f" || arg == "--format")
+			{
+				const std::string_view format = value();
+
+				if (format == "text")
+				{
+					options.Format = OutputFormat::Text;
+				}
+
+				else if (format == "json")
+				{
+					options.Format = OutputFormat::Json;
+				}
+
+				else
+				{
+					throw std::runtime_error("Unknown format: " + std::string(format));
+				}
+			}
+
+			else if (arg == "-b" || arg == "--base")
+			{
+				options.BaseAddress = ParseAddress(arg, value());
+			}
+
+			else if (arg == "-s" || arg == "--start")
+			{
+				options.StartAddress = ParseAddress(arg, value());
+				hasStart = true;
+			}
+
+			else if (arg == "-e" || arg == "--end")
+			{
+				options.EndAddress = ParseAddress(arg, value());
+			}
+
+			else if (arg == "-x" || arg == "--entry")
+			{
+				options.EntryPoints.push_back(ParseEntryPoint(arg, value()));
+			}
+
+			else if (arg == "-j" || arg == "--jobs")
+			{
+				options.Jobs = ParseJobs(arg, value());
+			}
+
+			else if (arg == "-t" || arg == "--targets")
+			{
+				options.MarkTargets = true;
+			}
+
+			else if (arg == "-o" || arg == "--output")
+			{
+				options.OutputPath = value();
+			}
+
+			else if (!arg.empty() && arg[0] == '-')
+			{
+				throw std::runtime_error("Unknown option: " + std::string(arg));
+			}
+
+			else if (options.InputPath.empty())
+			{
+				options.InputPath = arg;
+			}
+
+			else
+			{
+				throw std::runtime_error("More than one input file given");
+			}
+		}
+
+		if (options.InputPath.empty())
+		{
+			throw std::runtime_error("No input file given");
+		}
+
+		if (!hasStart)
+		{
+			options.StartAddress = options.BaseAddress;
+		}
+
+		if (options.StartAddress < options.BaseAddress)
+		{
+			throw std::runtime_error("Start address is below the base address");
+		}
+
+		if ((options.Jobs || options.MarkTargets) && !options.EntryPoints.empty())
+		{
+			throw std::runtime_error("--jobs and --targets cannot be combined with --entry");
+		}
+
+		return options;
+	}
+
+	/**
+	 * @brief Target of a relative jump or call, std::nullopt for other instructions.
+	 */
+	std::optional<u32> GetBranchTarget(const Instruction& instr)
+	{
+		const auto operandType = instr.Operands[0].Type;
+
+		if (operandType != disassembler::rel8 && operandType != disassembler::rel16)
+		{
+			return std::nullopt;
+		}
+
+		const s16 displacement = (operandType == disassembler::rel8)
+			? static_cast<s8>(instr.Operands[0].Value)
+			: static_cast<s16>(instr.Operands[0].Value);
+
+		// near branches wrap inside their 64 KiB segment
+		const u32 next = instr.Address + instr.Length;
+
+		return (next & ~0xFFFFu) | ((next + displacement) & 0xFFFFu);
+	}
+
+	/**
+	 * @brief Writes the tokens of an instruction in NASM syntax.
+	 *
+	 * @details
+	 * Lowercase, sizes without PTR, and the target address of relative jumps and calls
+	 * instead of their displacement, like ndisasm prints them.
+	 */
+	void WriteNasm(BufferedWriter& out, const Instruction& instr, const TokenArena& arena)
+	{
+		const auto tokens = arena.GetTokens(instr.Tokens);
+
+		auto writeLower = [&out](std::string_view text)
+		{
+			for (const char c : text)
+			{
+				out.Put(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+			}
+		};
+
+		if (const auto target = GetBranchTarget(instr))
+		{
+			writeLower(arena.GetText(tokens[0]));
+			out.Write(" 0x");
+			out.WriteHex(*target, *target > 0xFFFF ? 5 : 4);
+			return;
+		}
+
+		bool space = false;
+
+		for (const auto& token : tokens)
+		{
+			const std::string_view text = arena.GetText(token);
+
+			if (text == "PTR")
+			{
+				continue;
+			}
+
+			if (space)
+			{
+				out.Put(' ');
+			}
+
+			writeLower(text);
+			space = token.HasSpace;
+		}
+	}
+
+	void WriteBytes(BufferedWriter& out, const Instruction& instr)
+	{
+		for (u8 i = 0; i < instr.Length; ++i)
+		{
+			out.WriteHex(instr.Bytes[i], 2);
+		}
+	}
+
+	/**
+	 * @brief Writes one listing line, targetInside is the instruction a branch lands in the middle of, if any.
+	 */
+	void WriteTextLine(BufferedWriter& out, const Instruction& instr, const TokenArena& arena, std::optional<u32> targetInside = std::nullopt)
+	{
+		out.WriteHex(instr.Address, 8);
+		out.Write("  ");
+
+		WriteBytes(out, instr);
+
+		// ndisasm pads the bytes column to 18 characters
+		for (u8 i = instr.Length * 2; i < 18; ++i)
+		{
+			out.Put(' ');
+		}
+
+		WriteNasm(out, instr, arena);
+
+		if (targetInside)
+		{
+			out.Write("  ; inside ");
+			out.WriteHex(*targetInside, 8);
+		}
+
+		out.Put('\n');
+	}
+
+	void WriteJsonLine(BufferedWriter& out, const Instruction& instr, const TokenArena& arena, std::optional<u32> targetInside = std::nullopt)
+	{
+		// token text comes from the decoder's fixed alphabet, nothing needs escaping
+		out.Write("{\"address\":");
+		out.WriteDecimal(instr.Address);
+		out.Write(",\"length\":");
+		out.WriteDecimal(instr.Length);
+		out.Write(",\"bytes\":\"");
+		WriteBytes(out, instr);
+		out.Write("\",\"text\":\"");
+		WriteNasm(out, instr, arena);
+		out.Put('"');
+
+		if (targetInside)
+		{
+			out.Write(",\"target_inside\":");
+			out.WriteDecimal(*targetInside);
+		}
+
+		out.Write("}\n");
+	}
+
+	void Sweep(const Options& options, std::FILE* input, BufferedWriter& out)
+	{
+		Disassembler decoder;
+		TokenArena arena;
+
+		// the block keeps the tail of the previous one, an instruction never straddles two reads
+		constexpr u32 carryMax = Instruction::MAX_BYTES - 1;
+
+		std::vector<u8> block(BLOCK_SIZE + carryMax);
+		size_t blockSize = 0;
+		u32 blockAddress = options.StartAddress;
+		u32 ip = options.StartAddress;
+
+		const u32 endAddress = options.EndAddress ? options.EndAddress : 0xFFFFFFFFu;
+		bool endOfInput = false;
+
+		while (ip < endAddress && !endOfInput)
+		{
+			// move the unconsumed bytes to the front and refill the rest
+			const size_t consumed = ip - blockAddress;
+
+			std::memmove(block.data(), block.data() + consumed, blockSize - consumed);
+			blockSize -= consumed;
+			blockAddress = ip;
+
+			// bytes up to MAX_BYTES - 1 past the end are read, to complete the last instruction
+			const u64 wanted = std::min<u64>(block.size() - blockSize, static_cast<u64>(endAddress) + carryMax - (blockAddress + blockSize));
+			const size_t read = std::fread(block.data() + blockSize, 1, static_cast<size_t>(wanted), input);
+
+			blockSize += read;
+			endOfInput = (read < wanted) || (blockAddress + blockSize >= static_cast<u64>(endAddress) + carryMax);
+
+			if (std::ferror(input))
+			{
+				throw std::runtime_error("Failed to read " + options.InputPath);
+			}
+
+			decoder.SetSource({ block.data(), blockSize }, blockAddress);
+
+			const u64 blockEnd = static_cast<u64>(blockAddress) + blockSize;
+			const u64 decodeEnd = endOfInput ? std::min<u64>(blockEnd, endAddress) : blockEnd - carryMax;
+
+			while (ip < decodeEnd)
+			{
+				Instruction instr = decoder.DecodeAt(ip);
+
+				arena.Clear();
+				decoder.Format(instr, arena);
+
+				if (options.Format == OutputFormat::Json)
+				{
+					WriteJsonLine(out, instr, arena);
+				}
+
+				else
+				{
+					WriteTextLine(out, instr, arena);
+				}
+
+				ip += instr.Length;
+			}
+		}
+	}
+
+	const char* GetFlowKindName(FlowKind kind)
+	{
+		switch (kind)
+		{
+
+		case FlowKind::Jump:
+			return "jump";
+
+		case FlowKind::ConditionalJump:
+			return "branch";
+
+		case FlowKind::Call:
+			return "call";
+
+		default:
+			return "fall-through";
+		}
+	}
+
+	/**
+	 * @brief Writes the successors of a block, or the references to it when incoming is set, as "address (kind)".
+	 */
+	void WriteFlowEdges(BufferedWriter& out, std::span<const FlowEdge> edges, bool incoming)
+	{
+		for (size_t i = 0; i < edges.size(); ++i)
+		{
+			out.Write(i ? ", " : "");
+			out.WriteHex(incoming ? edges[i].From : edges[i].To, 8);
+			out.Write(" (");
+			out.Write(GetFlowKindName(edges[i].Kind));
+			out.Put(')');
+		}
+	}
+
+	void WriteJsonEdges(BufferedWriter& out, std::span<const FlowEdge> edges, bool incoming)
+	{
+		out.Put('[');
+
+		for (size_t i = 0; i < edges.size(); ++i)
+		{
+			out.Write(i ? ",{\"" : "{\"");
+			out.Write(incoming ? "from" : "to");
+			out.Write("\":");
+			out.WriteDecimal(incoming ? edges[i].From : edges[i].To);
+			out.Write(",\"kind\":\"");
+			out.Write(GetFlowKindName(edges[i].Kind));
+			out.Write("\"}");
+		}
+
+		out.Put(']');
+	}
+
+	void WriteTextBlock(BufferedWriter& out, const FlowAnalyzer& analyzer, const BasicBlock& block, const Disassembler& decoder, TokenArena& arena)
+	{
+		out.Write("\n; block ");
+		out.WriteHex(block.Segment, 4);
+		out.Put(':');
+		out.WriteHex(block.Start - (static_cast<u32>(block.Segment) << 4), 4);
+
+		const auto references = analyzer.GetReferencesTo(block.Start);
+
+		if (!references.empty())
+		{
+			out.Write(", from ");
+			WriteFlowEdges(out, references, true);
+		}
+
+		out.Put('\n');
+
+		for (u32 address = block.Start; address < block.End;)
+		{
+			Instruction instr = decoder.DecodeAt(address);
+
+			arena.Clear();
+			decoder.Format(instr, arena);
+			WriteTextLine(out, instr, arena);
+
+			address += instr.Length;
+		}
+
+		const auto successors = analyzer.GetSuccessors(block);
+
+		if (!successors.empty())
+		{
+			out.Write("; to ");
+			WriteFlowEdges(out, successors, false);
+			out.Put('\n');
+		}
+	}
+
+	void WriteJsonBlock(BufferedWriter& out, const FlowAnalyzer& analyzer, const BasicBlock& block)
+	{
+		out.Write("{\"start\":");
+		out.WriteDecimal(block.Start);
+		out.Write(",\"end\":");
+		out.WriteDecimal(block.End);
+		out.Write(",\"segment\":");
+		out.WriteDecimal(block.Segment);
+		out.Write(",\"instructions\":");
+		out.WriteDecimal(block.InstructionCount);
+		out.Write(block.IsCallTarget ? ",\"call_target\":true" : ",\"call_target\":false");
+		out.Write(",\"successors\":");
+		WriteJsonEdges(out, analyzer.GetSuccessors(block), false);
+		out.Write(",\"references\":");
+		WriteJsonEdges(out, analyzer.GetReferencesTo(block.Start), true);
+		out.Write("}\n");
+	}
+
+	/**
+	 * @brief Reads [start, end) of the input plus up to extra bytes past the end, or up to the end of the file.
+	 */
+	std::vector<u8> ReadRange(const Options& options, std::FILE* input, u32 extra = 0)
+	{
+		const u64 limit = options.EndAddress ? static_cast<u64>(options.EndAddress) + extra - options.StartAddress : std::numeric_limits<u64>::max();
+
+		std::vector<u8> code;
+		std::vector<u8> chunk(BLOCK_SIZE);
+
+		while (code.size() < limit)
+		{
+			const size_t wanted = static_cast<size_t>(std::min<u64>(chunk.size(), limit - code.size()));
+			const size_t read = std::fread(chunk.data(), 1, wanted, input);
+
+			code.insert(code.end(), chunk.begin(), chunk.begin() + read);
+
+			if (read < wanted)
+			{
+				break;
+			}
+		}
+
+		if (std::ferror(input))
+		{
+			throw std::runtime_error("Failed to read " + options.InputPath);
+		}
+
+		return code;
+	}
+
+	/**
+	 * @brief The bytes read from the input as a memory source, loaded at their start address.
+	 */
+	class ImageSource : public i8086::IMemorySource
+	{
+
+	public:
+
+		ImageSource(std::span<const u8> image, u32 baseAddress)
+			: mImage(image), mBaseAddress(baseAddress)
+		{
+		}
+
+		void ReadBlock(u32 physicalAddress, std::span<u8> buffer) const override
+		{
+			// bytes outside the image read as zero
+			std::fill(buffer.begin(), buffer.end(), u8{ 0 });
+
+			if (physicalAddress >= mBaseAddress && physicalAddress - mBaseAddress < mImage.size())
+			{
+				const auto bytes = mImage.subspan(physicalAddress - mBaseAddress);
+				std::copy_n(bytes.begin(), std::min(bytes.size(), buffer.size()), buffer.begin());
+			}
+		}
+
+		size_t GetSize() const override { return mBaseAddress + mImage.size(); }
+		u32 GetPageVersion(u32) const override { return 0; }
+
+	private:
+
+		std::span<const u8> mImage;
+		u32 mBaseAddress;
+	};
+
+	/**
+	 * @brief Decodes the whole of [start, end) into a listing, on several threads with --jobs, and lists it like Sweep.
+	 */
+	void ListRange(const Options& options, std::FILE* input, BufferedWriter& out)
+	{
+		// like Sweep, the last instruction may complete with bytes past the end
+		const std::vector<u8> image = ReadRange(options, input, Instruction::MAX_BYTES - 1);
+		const ImageSource source(image, options.StartAddress);
+
+		const u64 imageEnd = static_cast<u64>(options.StartAddress) + image.size();
+		const u32 endAddress = static_cast<u32>(options.EndAddress ? std::min<u64>(options.EndAddress, imageEnd) : imageEnd);
+
+		Disassembler decoder(&source);
+
+		if (options.Jobs)
+		{
+			decoder.ParallelDisassembly(options.StartAddress, endAddress, *options.Jobs);
+		}
+
+		else
+		{
+			decoder.Disassembly(options.StartAddress, endAddress);
+		}
+
+		const Listing& listing = decoder.GetListing();
+		TokenArena arena;
+
+		for (size_t row = 0; row < listing.Size(); ++row)
+		{
+			Instruction instr = listing.Get(row);
+
+			// a branch into the middle of an instruction: overlapping code, or data decoded as code
+			std::optional<u32> targetInside;
+
+			if (const auto target = options.MarkTargets ? GetBranchTarget(instr) : std::nullopt)
+			{
+				const size_t targetRow = listing.FindRow(*target);
+
+				if (targetRow != Listing::NOT_FOUND && listing.GetAddress(targetRow) != *target)
+				{
+					targetInside = listing.GetAddress(targetRow);
+				}
+			}
+
+			arena.Clear();
+			decoder.Format(instr, arena);
+
+			if (options.Format == OutputFormat::Json)
+			{
+				WriteJsonLine(out, instr, arena, targetInside);
+			}
+
+			else
+			{
+				WriteTextLine(out, instr, arena, targetInside);
+			}
+		}
+	}
+
+	/**
+	 * @brief Analyses [start, end) of the input from the entry points and lists the blocks in address order.
+	 */
+	void ListFlow(const Options& options, std::FILE* input, BufferedWriter& out)
+	{
+		const std::vector<u8> code = ReadRange(options, input);
+
+		FlowAnalyzer analyzer;
+
+		for (const auto& entry : options.EntryPoints)
+		{
+			analyzer.AddEntryPoint(entry.Segment, entry.Offset);
+		}
+
+		analyzer.Analyze(code, options.StartAddress);
+
+		Disassembler decoder;
+		TokenArena arena;
+
+		decoder.SetSource(code, options.StartAddress);
+
+		for (const auto& block : analyzer.GetBlocks())
+		{
+			if (options.Format == OutputFormat::Json)
+			{
+				WriteJsonBlock(out, analyzer, block);
+			}
+
+			else
+			{
+				WriteTextBlock(out, analyzer, block, decoder, arena);
+			}
+		}
+
+		// indirect jumps and calls, their targets are only known at run time
+		const auto unresolved = analyzer.GetUnresolved();
+
+		if (options.Format == OutputFormat::Json)
+		{
+			out.Write("{\"unresolved\":[");
+
+			for (size_t i = 0; i < unresolved.size(); ++i)
+			{
+				out.Write(i ? "," : "");
+				out.WriteDecimal(unresolved[i]);
+			}
+
+			out.Write("]}\n");
+		}
+
+		else if (!unresolved.empty())
+		{
+			out.Write("\n; unresolved ");
+
+			for (size_t i = 0; i < unresolved.size(); ++i)
+			{
+				out.Write(i ? ", " : "");
+				out.WriteHex(unresolved[i], 8);
+			}
+
+			out.Put('\n');
+		}
+	}
+
+	void Run(const Options& options)
+	{
+		FilePtr input(std::fopen(options.InputPath.c_str(), "rb"));
+
+		if (!input)
+		{
+			throw std::runtime_error("Cannot open " + options.InputPath);
+		}
+
+		FilePtr outputFile;
+
+		if (!options.OutputPath.empty())
+		{
+			outputFile.reset(std::fopen(options.OutputPath.c_str(), "wb"));
+
+			if (!outputFile)
+			{
+				throw std::runtime_error("Cannot create " + options.OutputPath);
+			}
+		}
+
+		if (std::fseek(input.get(), static_cast<long>(options.StartAddress - options.BaseAddress), SEEK_SET) != 0)
+		{
+			throw std::runtime_error("Cannot seek to the start address in " + options.InputPath);
+		}
+
+		BufferedWriter out(outputFile ? outputFile.get() : stdout);
+
+		if (!options.EntryPoints.empty())
+		{
+			ListFlow(options, input.get(), out);
+		}
+
+		else if (options.Jobs || options.MarkTargets)
+		{
+			ListRange(options, input.get(), out);
+		}
+
+		else
+		{
+			Sweep(options, input.get(), out);
+		}
+
+		out.Flush();
+	}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	try
+	{
+		Run(ParseOptions(argc, argv));
+	}
+
+	catch (const std::runtime_error& e)
+	{
+		std::fprintf(stderr, "i86dis: %s\n", e.what());
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <charconv>
+#include <cstdio>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Accumulates output in a fixed buffer and hands it to a FILE in large writes.
+ *
+ * @details
+ * Numbers are converted straight into the buffer, writing a line does not allocate.
+ * The buffer is flushed when full and on destruction.
+ */
+class BufferedWriter
+{
+
+public:
+
+	static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+	BufferedWriter(std::FILE* file, size_t capacity = DEFAULT_CAPACITY) : mFile(file)
+	{
+		mBuffer.resize(capacity);
+	}
+
+	~BufferedWriter()
+	{
+		// the destructor cannot report a failed write, call Flush first to see it
+		try
+		{
+			Flush();
+		}
+
+		catch (const std::runtime_error&)
+		{
+		}
+	}
+
+	BufferedWriter(const BufferedWriter&) = delete;
+	BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+	void Write(std::string_view text)
+	{
+		if (text.size() > mBuffer.size() - mSize)
+		{
+			Flush();
+
+			if (text.size() > mBuffer.size())
+			{
+				WriteFile(text.data(), text.size());
+				return;
+			}
+		}
+
+		text.copy(mBuffer.data() + mSize, text.size());
+		mSize += text.size();
+	}
+
+	void Put(char c)
+	{
+		if (mSize == mBuffer.size())
+		{
+			Flush();
+		}
+
+		mBuffer[mSize++] = c;
+	}
+
+	/**
+	 * @brief Writes value as uppercase hexadecimal, zero-padded to digits characters.
+	 */
+	void WriteHex(u32 value, u8 digits)
+	{
+		constexpr char hexDigits[] = "0123456789ABCDEF";
+
+		Reserve(digits);
+
+		for (u8 i = digits; i > 0; --i)
+		{
+			mBuffer[mSize + i - 1] = hexDigits[value & 0xF];
+			value >>= 4;
+		}
+
+		mSize += digits;
+	}
+
+	void WriteDecimal(u32 value)
+	{
+		Reserve(10);
+
+		const auto result = std::to_chars(mBuffer.data() + mSize, mBuffer.data() + mBuffer.size(), value);
+		mSize = static_cast<size_t>(result.ptr - mBuffer.data());
+	}
+
+	void Flush()
+	{
+		if (mSize > 0)
+		{
+			WriteFile(mBuffer.data(), mSize);
+			mSize = 0;
+		}
+
+		std::fflush(mFile);
+	}
+
+private:
+
+	void Reserve(size_t count)
+	{
+		if (count > mBuffer.size() - mSize)
+		{
+			Flush();
+		}
+	}
+
+	void WriteFile(const char* data, size_t size)
+	{
+		if (std::fwrite(data, 1, size, mFile) != size)
+		{
+			throw std::runtime_error("BufferedWriter::Flush -> Failed to write output");
+		}
+	}
+
+private:
+
+	std::FILE* const mFile;
+	std::vector<char> mBuffer;
+	size_t mSize{ 0 };
+};
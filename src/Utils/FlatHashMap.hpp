@@ -0,0 +1,165 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Open addressing hash map from u32 keys, with linear probing in one flat array.
+ *
+ * @details
+ * Meant for address-keyed lookups in analysis passes: no node allocations, lookups touch
+ * one or two cache lines. Elements cannot be erased, Clear() keeps the capacity.
+ */
+template<typename Value>
+class FlatHashMap
+{
+
+public:
+
+	void Clear()
+	{
+		for (auto& slot : mSlots)
+		{
+			slot.Used = false;
+		}
+
+		mSize = 0;
+	}
+
+	void Reserve(size_t count)
+	{
+		size_t capacity = 16;
+
+		// keep the load factor under 1/2
+		while (capacity < count * 2)
+		{
+			capacity *= 2;
+		}
+
+		if (capacity > mSlots.size())
+		{
+			Rehash(capacity);
+		}
+	}
+
+	size_t Size() const
+	{
+		return mSize;
+	}
+
+	/**
+	 * @brief Returns the value of key, inserting a default one first if it is missing.
+	 */
+	Value& operator[](u32 key)
+	{
+		if ((mSize + 1) * 2 > mSlots.size())
+		{
+			Rehash(mSlots.empty() ? 16 : mSlots.size() * 2);
+		}
+
+		Slot& slot = mSlots[FindSlot(key)];
+
+		if (!slot.Used)
+		{
+			slot.Used = true;
+			slot.Key = key;
+			slot.Data = Value{};
+			++mSize;
+		}
+
+		return slot.Data;
+	}
+
+	const Value* Find(u32 key) const
+	{
+		if (mSlots.empty())
+		{
+			return nullptr;
+		}
+
+		const Slot& slot = mSlots[FindSlot(key)];
+
+		return slot.Used ? &slot.Data : nullptr;
+	}
+
+	Value* Find(u32 key)
+	{
+		return const_cast<Value*>(std::as_const(*this).Find(key));
+	}
+
+	bool Contains(u32 key) const
+	{
+		return Find(key) != nullptr;
+	}
+
+	template<typename Function>
+	void ForEach(Function&& function) const
+	{
+		for (const auto& slot : mSlots)
+		{
+			if (slot.Used)
+			{
+				function(slot.Key, slot.Data);
+			}
+		}
+	}
+
+private:
+
+	struct Slot
+	{
+		u32 Key{};
+		bool Used{ false };
+		Value Data{};
+	};
+
+	static u32 Hash(u32 key)
+	{
+		// nearby addresses must not fill neighbouring slots, mix all bits into the low ones
+		key ^= key >> 16;
+		key *= 0x7FEB352Du;
+		key ^= key >> 15;
+		key *= 0x846CA68Bu;
+		key ^= key >> 16;
+
+		return key;
+	}
+
+	size_t FindSlot(u32 key) const
+	{
+		const size_t mask = mSlots.size() - 1;
+		size_t index = Hash(key) & mask;
+
+		while (mSlots[index].Used && mSlots[index].Key != key)
+		{
+			index = (index + 1) & mask;
+		}
+
+		return index;
+	}
+
+	void Rehash(size_t capacity)
+	{
+		std::vector<Slot> old(capacity);
+		old.swap(mSlots);
+
+		for (auto& slot : old)
+		{
+			if (slot.Used)
+			{
+				mSlots[FindSlot(slot.Key)] = std::move(slot);
+			}
+		}
+	}
+
+private:
+
+	std::vector<Slot> mSlots;
+	size_t mSize{ 0 };
+};
@@ -0,0 +1,68 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ * @details
+ * A ring of Capacity slots with a head advanced only by the producer and a tail advanced
+ * only by the consumer, so pushing and popping never wait. TryPush fails when the ring is full.
+ */
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+
+	static_assert((Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+
+	bool TryPush(T item)
+	{
+		const size_t head = mHead.load(std::memory_order_relaxed);
+
+		if (head - mTail.load(std::memory_order_acquire) == Capacity)
+		{
+			return false;
+		}
+
+		mItems[head & (Capacity - 1)] = std::move(item);
+		mHead.store(head + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	bool TryPop(T& outItem)
+	{
+		const size_t tail = mTail.load(std::memory_order_relaxed);
+
+		if (tail == mHead.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		outItem = std::move(mItems[tail & (Capacity - 1)]);
+		mTail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	bool IsEmpty() const
+	{
+		return mTail.load(std::memory_order_acquire) == mHead.load(std::memory_order_acquire);
+	}
+
+private:
+
+	std::array<T, Capacity> mItems{};
+
+	alignas(64) std::atomic<size_t> mHead{ 0 };
+	alignas(64) std::atomic<size_t> mTail{ 0 };
+};
@@ -0,0 +1,127 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed set of worker threads for fork-join loops, started once and reused by every call.
+ *
+ * @details
+ * ParallelFor hands out the indices of one loop to the workers and returns when all of
+ * them ran; the calling thread only waits. One loop runs at a time, callers on several
+ * threads are serialized.
+ */
+class ThreadPool
+{
+
+public:
+
+	explicit ThreadPool(unsigned threadCount)
+	{
+		mWorkers.reserve(threadCount);
+
+		for (unsigned i = 0; i < threadCount; ++i)
+		{
+			mWorkers.emplace_back([this] { WorkerLoop(); });
+		}
+	}
+
+	~ThreadPool()
+	{
+		{
+			std::lock_guard lock(mMutex);
+			mStop = true;
+		}
+
+		mWake.notify_all();
+
+		for (auto& worker : mWorkers)
+		{
+			worker.join();
+		}
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	unsigned GetThreadCount() const
+	{
+		return static_cast<unsigned>(mWorkers.size());
+	}
+
+	/**
+	 * @brief Runs task(i) for every i in [0, count) on the workers and waits for all of them.
+	 */
+	void ParallelFor(size_t count, const std::function<void(size_t)>& task)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		std::lock_guard call(mCallMutex);
+		std::unique_lock lock(mMutex);
+
+		mTask = &task;
+		mCount = count;
+		mNext = 0;
+		mPending = count;
+
+		mWake.notify_all();
+		mDone.wait(lock, [this] { return mPending == 0; });
+
+		mTask = nullptr;
+	}
+
+private:
+
+	void WorkerLoop()
+	{
+		std::unique_lock lock(mMutex);
+
+		while (true)
+		{
+			mWake.wait(lock, [this] { return mStop || (mTask != nullptr && mNext < mCount); });
+
+			if (mStop)
+			{
+				return;
+			}
+
+			const size_t index = mNext++;
+			const auto& task = *mTask;
+
+			lock.unlock();
+			task(index);
+			lock.lock();
+
+			if (--mPending == 0)
+			{
+				mDone.notify_one();
+			}
+		}
+	}
+
+private:
+
+	std::vector<std::thread> mWorkers;
+
+	std::mutex mCallMutex;
+	std::mutex mMutex;
+	std::condition_variable mWake;
+	std::condition_variable mDone;
+
+	const std::function<void(size_t)>* mTask{ nullptr };
+	size_t mCount{ 0 };
+	size_t mNext{ 0 };
+	size_t mPending{ 0 };
+	bool mStop{ false };
+};
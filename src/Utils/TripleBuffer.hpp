@@ -0,0 +1,95 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Utils/types.hpp>
+
+#include <array>
+#include <atomic>
+
+/**
+ * @brief Lock-free hand-over of the latest value from one writer thread to one reader thread.
+ *
+ * @details
+ * Three buffers: the writer fills its own and publishes it by swapping it with the middle
+ * one, the reader takes the middle one by swapping it with its own. Neither side waits for
+ * the other and the reader always gets the most recent complete value; values published
+ * while the reader was not looking are skipped.
+ */
+template<typename T>
+class TripleBuffer
+{
+
+public:
+
+	/**
+	 * @brief Writer side: the buffer to fill before the next Publish.
+	 *
+	 * @details
+	 * Holds whatever was published two or three times ago, not the last value.
+	 */
+	T& GetWriteBuffer()
+	{
+		return mBuffers[mWriteIndex];
+	}
+
+	/**
+	 * @brief Writer side: makes the write buffer the latest value.
+	 *
+	 * @return false if the previous value was replaced before the reader took it.
+	 */
+	bool Publish()
+	{
+		const u8 previous = mMiddle.exchange(mWriteIndex | FRESH, std::memory_order_acq_rel);
+		mWriteIndex = previous & INDEX_MASK;
+
+		return !(previous & FRESH);
+	}
+
+	/**
+	 * @brief Writer side: true if the reader has taken the last published value.
+	 */
+	bool IsTaken() const
+	{
+		return !(mMiddle.load(std::memory_order_acquire) & FRESH);
+	}
+
+	/**
+	 * @brief Reader side: switches to the latest published value if there is a newer one.
+	 *
+	 * @return true if the read buffer changed.
+	 */
+	bool Acquire()
+	{
+		if (!(mMiddle.load(std::memory_order_relaxed) & FRESH))
+		{
+			return false;
+		}
+
+		const u8 previous = mMiddle.exchange(mReadIndex, std::memory_order_acq_rel);
+		mReadIndex = previous & INDEX_MASK;
+
+		return true;
+	}
+
+	/**
+	 * @brief Reader side: the value taken by the last Acquire.
+	 */
+	const T& GetReadBuffer() const
+	{
+		return mBuffers[mReadIndex];
+	}
+
+private:
+
+	static constexpr u8 INDEX_MASK = 0x03;
+	static constexpr u8 FRESH = 0x04;
+
+	std::array<T, 3> mBuffers{};
+
+	alignas(64) u8 mWriteIndex{ 0 };
+	alignas(64) u8 mReadIndex{ 1 };
+	alignas(64) std::atomic<u8> mMiddle{ 2 };
+};
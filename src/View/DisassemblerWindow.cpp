@@ -5,6 +5,7 @@
 #include "DisassemblerWindow.hpp"
 
 #include <charconv>
+#include <cstdio>
 
 namespace UI
 {
@@ -31,6 +32,18 @@ namespace UI
 		RenderWindow();
 	}
 
+	void DisassemblerWindow::GoTo(u32 startAddress, u32 endAddress)
+	{
+		mDisassemblerController->startAddress = startAddress;
+		mDisassemblerController->endAddress = endAddress;
+		mDisassemblerController->Disassembly();
+
+		snprintf(mStartAddrBuf, sizeof(mStartAddrBuf), "%X", startAddress);
+		snprintf(mEndAddrBuf, sizeof(mEndAddrBuf), "%X", endAddress);
+
+		mIsOpen = true;
+	}
+
     inline void DisassemblerWindow::RenderWindow()
     {
 
@@ -64,6 +77,20 @@ namespace UI
 			ImGui::SameLine();
 			RenderCheckBox("Bytes", "Show Bytes of instructions", &mShowBytes);
 
+			if (!mDisassemblerController->IsIndexComplete())
+			{
+				ImGui::SameLine();
+				ImGui::TextDisabled("Indexing... %zu instructions", mDisassemblerController->GetDisassembledInstructionsCount());
+			}
+
+			else if (mDisassemblerController->GetDisassembledInstructionsCount() > 0)
+			{
+				ImGui::SameLine();
+				ImGui::TextDisabled("%zu instructions, %.0f instr/s",
+					mDisassemblerController->GetDisassembledInstructionsCount(),
+					mDisassemblerController->GetInstructionsPerSecond());
+			}
+
 			RenderInstructions();
 
 		}
@@ -87,6 +114,9 @@ namespace UI
 		
 		ImGui::Spacing();
 
+		// follow guest writes to the listed code
+		mDisassemblerController->Refresh();
+
 		ImGuiListClipper clipper;
 		
 		const int instructionsCount = static_cast<int>(mDisassemblerController->GetDisassembledInstructionsCount());
@@ -95,16 +125,19 @@ namespace UI
 
 		while (clipper.Step()) {
 
+			// only the rows on screen are decoded and formatted
+			mDisassemblerController->PrepareRows(clipper.DisplayStart, clipper.DisplayEnd);
+
 			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
 
-				auto& instr = mDisassemblerController->GetDisassembledInstruction(i);
+				const auto& instr = mDisassemblerController->GetDisassembledInstruction(i);
+				const bool breakpoint = mCPUController->HasBreakpoint(instr.Address);
 
-				RenderBreakpointButton(instr);
+				RenderBreakpointButton(instr.Address, breakpoint);
 				
 				if (ImGui::IsItemClicked())
 				{
-					instr.Breakpoint = !instr.Breakpoint;
-					mCPUController->SetBreakpoint(instr.Address, instr.Breakpoint);
+					mCPUController->SetBreakpoint(instr.Address, !breakpoint);
 				}
 
 				if (mShowAddress) {
@@ -112,22 +145,22 @@ namespace UI
 				}
 
 				if (mShowBytes) {
-					RenderBytes(instr.Bytes);
+					RenderBytes(instr);
 				}
 
-				RenderTokens(instr.Tokens);
+				RenderTokens(instr);
 			}
 		}
 
 		ImGui::EndChild();
 	}
 
-	inline void DisassemblerWindow::RenderBreakpointButton(const disassembler::DisassembledInstruction& instr) const
+	inline void DisassemblerWindow::RenderBreakpointButton(u32 address, bool breakpoint) const
 	{
 		const ImVec2 pos = ImGui::GetCursorScreenPos();
 		const ImVec2 breakpointBtnCenter{ pos.x + breakpointBtnSize.x / 2, pos.y + breakpointBtnSize.y / 2 };
 
-		ImGui::PushID(instr.Address);
+		ImGui::PushID(address);
 		ImGui::InvisibleButton("##BP", breakpointBtnSize);
 		ImGui::PopID();
 
@@ -138,7 +171,7 @@ namespace UI
 			drawList->AddCircleFilled(breakpointBtnCenter, 6.0f, mColorTheme.BreakpointHoveredColor);
 		}
 
-		if (instr.Breakpoint) {
+		if (breakpoint) {
 			drawList->AddCircleFilled(breakpointBtnCenter, 6.0f, mColorTheme.BreakpointClickedColor);
 		}
 
@@ -151,10 +184,10 @@ namespace UI
 		ImGui::SameLine(0.0f, 0.0f);
 	}
 
-	inline void DisassemblerWindow::RenderBytes(const std::vector<u8>& bytes) const
+	inline void DisassemblerWindow::RenderBytes(const disassembler::Instruction& instr) const
 	{
 		const u8 maxBytesCount = mDisassemblerController->GetMaxInstrBytesCount();
-		const u8 emptyBytesCount = maxBytesCount - static_cast<u8>(bytes.size());
+		const u8 emptyBytesCount = maxBytesCount - instr.Length;
 
 		for (u8 i = 0; i < emptyBytesCount; ++i)
 		{
@@ -165,20 +198,22 @@ namespace UI
 		for (u8 i = 0; i < (maxBytesCount - emptyBytesCount); ++i)
 		{
 			ImGui::SameLine(0.0f, 0.0f);
-			ImGui::TextColored(mColorTheme.BytesColor, "%02X ", bytes[i]);
+			ImGui::TextColored(mColorTheme.BytesColor, "%02X ", instr.Bytes[i]);
 		}
 	}
 
-	inline void DisassemblerWindow::RenderTokens(const std::vector<disassembler::Token>& tokens) const
+	inline void DisassemblerWindow::RenderTokens(const disassembler::Instruction& instr) const
 	{
-		for (const auto& token : tokens)
+		for (const auto& token : mDisassemblerController->GetTokens(instr))
 		{
+			const std::string_view text = mDisassemblerController->GetTokenText(token);
+
 			ImGui::SameLine(0.0f, 0.0f);
-			ImGui::PushStyleColor(ImGuiCol_Text, mColorTheme.TokenColorsMap.at(token.type));
+			ImGui::PushStyleColor(ImGuiCol_Text, mColorTheme.TokenColors[token.Type]);
 
-			ImGui::Text(token.token.c_str());
+			ImGui::TextUnformatted(text.data(), text.data() + text.size());
 
-			if (token.hasSpace)
+			if (token.HasSpace)
 			{
 				ImGui::SameLine(0.0f, 0.0f);
 				ImGui::TextUnformatted(" ");
@@ -27,15 +27,20 @@ namespace UI
 
 		void ShowIfOpen() override;
 
+		/**
+		 * @brief Opens the window on a new listing of [startAddress, endAddress).
+		 */
+		void GoTo(u32 startAddress, u32 endAddress);
+
 	private:
 
 		inline void RenderWindow();
 		inline void RenderCheckBox(const char* label, const char* tooltip, bool* v) const;
 		inline void RenderInstructions() const;
-		inline void RenderBreakpointButton(const disassembler::DisassembledInstruction& instr) const;
+		inline void RenderBreakpointButton(u32 address, bool breakpoint) const;
 		inline void RenderAddress(u32 address) const;
-		inline void RenderBytes(const std::vector<u8>& bytes) const;
-		inline void RenderTokens(const std::vector<disassembler::Token>& tokens) const;
+		inline void RenderBytes(const disassembler::Instruction& instr) const;
+		inline void RenderTokens(const disassembler::Instruction& instr) const;
 
 	private:
 
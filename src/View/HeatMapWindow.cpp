@@ -0,0 +1,213 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "HeatMapWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numbers>
+#include <stdexcept>
+
+namespace UI
+{
+
+	using i8086::MemoryHeatMap;
+
+	constexpr u32 ROWS = MemoryHeatMap::BLOCK_COUNT / HeatMapWindow::COLUMNS;
+	constexpr u32 LABEL_EVERY = 4; // rows, one label per 64 KiB
+
+	constexpr const char* KIND_NAMES[MemoryHeatMap::KIND_COUNT] = { "Reads", "Writes", "Executes" };
+
+	constexpr ImU32 BACKGROUND_COLOR = IM_COL32(20, 20, 24, 255);
+
+	HeatMapWindow::HeatMapWindow(i8086::EmulationThread* emulation, MemoryEditorWindow* memoryEditorWindow, DisassemblerWindow* disassemblerWindow)
+		: mEmulation(emulation), mMemoryEditorWindow(memoryEditorWindow), mDisassemblerWindow(disassemblerWindow)
+	{
+		if (!mEmulation || !mMemoryEditorWindow || !mDisassemblerWindow)
+		{
+			throw std::runtime_error("HeatMapWindow::HeatMapWindow -> Emulation thread or a linked window is not initialized");
+		}
+
+		mHeat.assign(MemoryHeatMap::KIND_COUNT * MemoryHeatMap::BLOCK_COUNT, 0.0f);
+	}
+
+	void HeatMapWindow::ShowIfOpen()
+	{
+		// blocks are only counted while the window can show them
+		if (mMapping != mIsOpen && mEmulation->RecordHeat(mIsOpen))
+		{
+			mMapping = mIsOpen;
+			mHasBaseline = false;
+		}
+
+		if (!mIsOpen)
+		{
+			return;
+		}
+
+		UpdateHeat();
+
+		if (ImGui::Begin("Heat map", &mIsOpen))
+		{
+			for (int kind = 0; kind < MemoryHeatMap::KIND_COUNT; ++kind)
+			{
+				if (kind > 0)
+				{
+					ImGui::SameLine();
+				}
+
+				ImGui::Checkbox(KIND_NAMES[kind], &mShown[kind]);
+			}
+
+			ImGui::SameLine();
+			ImGui::TextDisabled("(click: memory, right click: disassembly)");
+
+			RenderMap();
+		}
+
+		ImGui::End();
+	}
+
+	void HeatMapWindow::UpdateHeat()
+	{
+		const double now = ImGui::GetTime();
+		const float decay = std::exp2(-static_cast<float>(now - mLastTime) / HALF_LIFE);
+
+		mLastTime = now;
+
+		for (float& heat : mHeat)
+		{
+			heat *= decay;
+		}
+
+		const i8086::EmulatorSnapshot& snapshot = mEmulation->GetSnapshot();
+
+		if (snapshot.HeatMapping && snapshot.Sequence != mLastSequence && snapshot.Heat.size() == mHeat.size())
+		{
+			mLastSequence = snapshot.Sequence;
+
+			// counts wrap at 2^32, the unsigned difference is still what they grew by
+			if (mHasBaseline)
+			{
+				for (size_t i = 0; i < mHeat.size(); ++i)
+				{
+					mHeat[i] += static_cast<float>(snapshot.Heat[i] - mLastCounts[i]);
+				}
+			}
+
+			mLastCounts = snapshot.Heat;
+			mHasBaseline = true;
+		}
+
+		for (int kind = 0; kind < MemoryHeatMap::KIND_COUNT; ++kind)
+		{
+			const auto first = mHeat.begin() + MemoryHeatMap::GetIndex(static_cast<Kind>(kind), 0);
+
+			mMaxHeat[kind] = *std::max_element(first, first + MemoryHeatMap::BLOCK_COUNT);
+		}
+	}
+
+	void HeatMapWindow::RenderMap()
+	{
+		const float labelWidth = ImGui::CalcTextSize("00000 ").x;
+		const ImVec2 available = ImGui::GetContentRegionAvail();
+		const float cell = std::max(2.0f, std::floor(std::min(available.x - labelWidth, available.y) / COLUMNS));
+
+		const ImVec2 origin = ImGui::GetCursorScreenPos();
+		const ImVec2 mapMin(origin.x + labelWidth, origin.y);
+		const ImVec2 mapMax(mapMin.x + cell * COLUMNS, mapMin.y + cell * ROWS);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+		for (u32 row = 0; row < ROWS; row += LABEL_EVERY)
+		{
+			char label[8];
+			snprintf(label, sizeof(label), "%05X", row * COLUMNS * MemoryHeatMap::BLOCK_SIZE);
+
+			drawList->AddText(ImVec2(origin.x, mapMin.y + row * cell), ImGui::GetColorU32(ImGuiCol_Text), label);
+		}
+
+		drawList->AddRectFilled(mapMin, mapMax, BACKGROUND_COLOR);
+
+		// log scale, a loop runs orders of magnitude more often than the code around it
+		std::array<float, MemoryHeatMap::KIND_COUNT> scale{};
+
+		for (int kind = 0; kind < MemoryHeatMap::KIND_COUNT; ++kind)
+		{
+			scale[kind] = (mShown[kind] && mMaxHeat[kind] > 0.0f) ? 255.0f / std::log1p(mMaxHeat[kind]) : 0.0f;
+		}
+
+		for (u32 block = 0; block < MemoryHeatMap::BLOCK_COUNT; ++block)
+		{
+			const auto level = [&](Kind kind) {
+				return static_cast<ImU32>(std::log1p(mHeat[MemoryHeatMap::GetIndex(kind, block)]) * scale[kind]);
+			};
+
+			const ImU32 read = level(MemoryHeatMap::Read);
+			const ImU32 write = level(MemoryHeatMap::Write);
+			const ImU32 execute = level(MemoryHeatMap::Execute);
+
+			if ((read | write | execute) == 0)
+			{
+				continue;
+			}
+
+			const ImVec2 min(mapMin.x + (block % COLUMNS) * cell, mapMin.y + (block / COLUMNS) * cell);
+
+			drawList->AddRectFilled(min, ImVec2(min.x + cell, min.y + cell), IM_COL32(execute, write, read, 255));
+		}
+
+		ImGui::SetCursorScreenPos(mapMin);
+		ImGui::InvisibleButton("##HeatMap", ImVec2(mapMax.x - mapMin.x, mapMax.y - mapMin.y), ImGuiButtonFlags_MouseButtonLeft | ImGuiButtonFlags_MouseButtonRight);
+
+		if (!ImGui::IsItemHovered())
+		{
+			return;
+		}
+
+		const ImVec2 mouse = ImGui::GetMousePos();
+		const u32 column = std::min<u32>(static_cast<u32>((mouse.x - mapMin.x) / cell), COLUMNS - 1);
+		const u32 row = std::min<u32>(static_cast<u32>((mouse.y - mapMin.y) / cell), ROWS - 1);
+		const u32 block = row * COLUMNS + column;
+		const u32 first = block << MemoryHeatMap::BLOCK_BITS;
+
+		drawList->AddRect(
+			ImVec2(mapMin.x + column * cell, mapMin.y + row * cell),
+			ImVec2(mapMin.x + (column + 1) * cell, mapMin.y + (row + 1) * cell),
+			IM_COL32(255, 255, 255, 255)
+		);
+
+		RenderTooltip(block);
+
+		if (ImGui::IsItemClicked(ImGuiMouseButton_Left))
+		{
+			mMemoryEditorWindow->GoTo(first, first + MemoryHeatMap::BLOCK_SIZE - 1);
+		}
+
+		else if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
+		{
+			mDisassemblerWindow->GoTo(first, first + MemoryHeatMap::BLOCK_SIZE);
+		}
+	}
+
+	void HeatMapWindow::RenderTooltip(u32 block) const
+	{
+		const u32 first = block << MemoryHeatMap::BLOCK_BITS;
+
+		// a steady rate r settles the heat at r * HALF_LIFE / ln 2
+		const float toRate = std::numbers::ln2_v<float> / HALF_LIFE;
+
+		ImGui::BeginTooltip();
+		ImGui::Text("%05X-%05X", first, first + MemoryHeatMap::BLOCK_SIZE - 1);
+
+		for (int kind = 0; kind < MemoryHeatMap::KIND_COUNT; ++kind)
+		{
+			ImGui::Text("%-8s %.0f/s", KIND_NAMES[kind], mHeat[MemoryHeatMap::GetIndex(static_cast<Kind>(kind), block)] * toRate);
+		}
+
+		ImGui::EndTooltip();
+	}
+
+} // namespace UI
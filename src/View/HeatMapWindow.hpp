@@ -0,0 +1,70 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include "DisassemblerWindow.hpp"
+#include "MemoryEditorWindow.hpp"
+
+#include <Interfaces/IViewWindow.hpp>
+#include <Model/EmulationThread.hpp>
+#include <Model/MemoryHeatMap.hpp>
+
+#include <imgui.h>
+
+#include <array>
+#include <vector>
+
+namespace UI
+{
+
+	/**
+	 * @brief The 1 MiB address space as a grid of MemoryHeatMap blocks, coloured by how much they were accessed lately.
+	 *
+	 * @details
+	 * Each snapshot brings the counts of every block so far; what they grew by since the last
+	 * one is added to a per-block heat that halves every HALF_LIFE seconds. Reads, writes and
+	 * executes each drive a colour channel, scaled against the hottest block of their kind.
+	 *
+	 * Hovering a block shows its address range and rates, clicking opens it in the memory
+	 * editor, right clicking disassembles it. Counting is on only while the window is open.
+	 */
+	class HeatMapWindow : public IViewWindow
+	{
+
+	public:
+
+		static constexpr u32 COLUMNS = 64; // blocks per row, a row covers 16 KiB
+		static constexpr float HALF_LIFE = 0.5f;
+
+		HeatMapWindow(i8086::EmulationThread* emulation, MemoryEditorWindow* memoryEditorWindow, DisassemblerWindow* disassemblerWindow);
+
+		void ShowIfOpen() override;
+
+	private:
+
+		using Kind = i8086::MemoryHeatMap::Kind;
+
+		void UpdateHeat();
+		void RenderMap();
+		void RenderTooltip(u32 block) const;
+
+	private:
+
+		i8086::EmulationThread* const mEmulation{ nullptr };
+		MemoryEditorWindow* const mMemoryEditorWindow{ nullptr };
+		DisassemblerWindow* const mDisassemblerWindow{ nullptr };
+
+		bool mMapping{ false };
+		bool mHasBaseline{ false }; // mLastCounts holds counts of the current mapping
+		u64 mLastSequence{ 0 };
+		double mLastTime{ 0.0 };
+
+		std::vector<u32> mLastCounts;
+		std::vector<float> mHeat; // per MemoryHeatMap::GetIndex, decayed accesses
+		std::array<float, i8086::MemoryHeatMap::KIND_COUNT> mMaxHeat{};
+		std::array<bool, i8086::MemoryHeatMap::KIND_COUNT> mShown{ true, true, true };
+	};
+
+} // namespace UI
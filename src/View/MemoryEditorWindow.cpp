@@ -4,31 +4,55 @@
 
 #include "MemoryEditorWindow.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace UI
 {
 
-    MemoryEditorWindow::MemoryEditorWindow(i8086::MemoryBus* bus)
+    using i8086::AccessRecorder;
+
+    constexpr ImU32 READ_COLOR  = IM_COL32(15, 166, 247, 0);
+    constexpr ImU32 WRITE_COLOR = IM_COL32(81, 245, 149, 0);
+    constexpr float HIGHLIGHT_ALPHA = 90.0f;
+
+    MemoryEditorWindow::MemoryEditorWindow(i8086::EmulationThread* emulation) : mEmulation(emulation)
     {
+        if (!mEmulation)
+        {
+            throw std::runtime_error("MemoryEditorWindow::MemoryEditorWindow -> Emulation thread is not initialized");
+        }
+
         mMemoryEditor.Cols = 48;
         mMemoryEditor.ReadOnly = true;
         mMemoryEditor.PreviewEndianness = 1;
         mMemoryEditor.PreviewDataType = ImGuiDataType_U16;
-
-        mBus = bus;
-
-        mBus->RegisterObserver(this);
+        mMemoryEditor.UserData = this;
+        mMemoryEditor.BgColorFn = &MemoryEditorWindow::GetByteColor;
     }
 
     void MemoryEditorWindow::ShowIfOpen()
     {
+        // accesses are only recorded while the window can show them
+        if (mRecording != mIsOpen && mEmulation->RecordAccesses(mIsOpen))
+        {
+            mRecording = mIsOpen;
+        }
+
         if (!mIsOpen)
         {
             return;
         }
 
+        UpdateHighlights();
+
         if (ImGui::Begin("Memory editor", &mIsOpen))
         {
-            mBus->DumpMemory(mMemDump);
+            // the bus belongs to the emulation thread, the dump comes from its latest snapshot
+            const i8086::IMemorySource* memory = mEmulation->GetMemory();
+
+            mMemDump.resize(memory->GetSize());
+            memory->ReadBlock(0, mMemDump);
 
             mMemoryEditor.DrawContents(mMemDump.data(), mMemDump.size(), 0);
         }
@@ -36,22 +60,73 @@ namespace UI
         ImGui::End();
     }
 
-    void MemoryEditorWindow::OnWrite(u32 address, u16 data)
+    void MemoryEditorWindow::GoTo(u32 first, u32 last)
     {
-        if (mIsOpen)
+        mIsOpen = true;
+        mMemoryEditor.GotoAddrAndHighlight(first, static_cast<size_t>(last) + 1);
+    }
+
+    void MemoryEditorWindow::UpdateHighlights()
+    {
+        const i8086::EmulatorSnapshot& snapshot = mEmulation->GetSnapshot();
+
+        mNow = static_cast<float>(ImGui::GetTime());
+
+        const size_t lines = (snapshot.Memory.GetSize() + AccessRecorder::LINE_SIZE - 1) >> AccessRecorder::LINE_BITS;
+
+        if (mReadTimes.size() != lines)
         {
-            mMemoryEditor.HighlightColor = IM_COL32(81, 245, 149, 50);
-            mMemoryEditor.GotoAddrAndHighlight(address, address);
+            mReadTimes.assign(lines, -HIGHLIGHT_DECAY);
+            mWriteTimes.assign(lines, -HIGHLIGHT_DECAY);
+        }
+
+        if (snapshot.Sequence != mLastSequence)
+        {
+            mLastSequence = snapshot.Sequence;
+
+            MarkRanges(mReadTimes, snapshot.Reads, mNow);
+            MarkRanges(mWriteTimes, snapshot.Writes, mNow);
+        }
+    }
+
+    void MemoryEditorWindow::MarkRanges(std::vector<float>& times, const std::vector<i8086::AccessRange>& ranges, float now)
+    {
+        for (const auto& range : ranges)
+        {
+            const size_t last = std::min<size_t>(range.Last >> AccessRecorder::LINE_BITS, times.size() - 1);
+
+            for (size_t line = range.First >> AccessRecorder::LINE_BITS; line <= last; ++line)
+            {
+                times[line] = now;
+            }
         }
     }
 
-    void MemoryEditorWindow::OnRead(u32 address)
+    ImU32 MemoryEditorWindow::GetByteColor(const ImU8*, size_t offset, void* userData)
     {
-        if (mIsOpen)
+        const auto* self = static_cast<const MemoryEditorWindow*>(userData);
+        const size_t line = offset >> AccessRecorder::LINE_BITS;
+
+        if (line >= self->mWriteTimes.size())
         {
-            mMemoryEditor.HighlightColor = IM_COL32(15, 166, 247, 50);
-            mMemoryEditor.GotoAddrAndHighlight(address, address);
+            return 0;
         }
+
+        // a write wins over a read of the same age, the colour fades with the age of the access
+        const float writeAge = self->mNow - self->mWriteTimes[line];
+        const float readAge = self->mNow - self->mReadTimes[line];
+
+        const bool isWrite = writeAge <= readAge;
+        const float age = isWrite ? writeAge : readAge;
+
+        if (age >= HIGHLIGHT_DECAY)
+        {
+            return 0;
+        }
+
+        const auto alpha = static_cast<ImU32>(HIGHLIGHT_ALPHA * (1.0f - age / HIGHLIGHT_DECAY));
+
+        return (isWrite ? WRITE_COLOR : READ_COLOR) | (alpha << IM_COL32_A_SHIFT);
     }
 
-} // namespace UI
\ No newline at end of file
+} // namespace UI
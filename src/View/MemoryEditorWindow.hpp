@@ -4,9 +4,9 @@
 
 #pragma once
 
-#include <Interfaces/IMemoryObserver.hpp>
 #include <Interfaces/IViewWindow.hpp>
-#include <Model/MemoryBus.hpp>
+#include <Model/AccessRecorder.hpp>
+#include <Model/EmulationThread.hpp>
 
 #include <imgui.h>
 #include <imgui_memory_editor.h>
@@ -16,23 +16,46 @@
 namespace UI
 {
 
-	class MemoryEditorWindow : public i8086::IMemoryObserver, public IViewWindow
+	/**
+	 * @brief Hex view of the latest snapshot, with the lines the CPU accessed lately fading out.
+	 *
+	 * @details
+	 * Access ranges arrive with the snapshots. Each line keeps the time it was last read and
+	 * written, and the editor asks for the colour of the visible bytes only.
+	 */
+	class MemoryEditorWindow : public IViewWindow
 	{
 
 	public:
 
-		MemoryEditorWindow(i8086::MemoryBus* bus);
+		static constexpr float HIGHLIGHT_DECAY = 0.75f; // seconds an access stays visible
+
+		MemoryEditorWindow(i8086::EmulationThread* emulation);
 
 		void ShowIfOpen() override;
 
-		void OnWrite(u32 address, u16 data) override;
-		void OnRead(u32 address) override;
+		/**
+		 * @brief Opens the window scrolled to [first, last], which is highlighted.
+		 */
+		void GoTo(u32 first, u32 last);
+
+	private:
+
+		void UpdateHighlights();
+		static void MarkRanges(std::vector<float>& times, const std::vector<i8086::AccessRange>& ranges, float now);
+		static ImU32 GetByteColor(const ImU8* memory, size_t offset, void* userData);
 
 	private:
 		std::vector<u8> mMemDump;
 		MemoryEditor mMemoryEditor;
-		i8086::MemoryBus* mBus{ nullptr };
+		i8086::EmulationThread* const mEmulation{ nullptr };
+
+		bool mRecording{ false };
+		u64 mLastSequence{ 0 };
+		float mNow{ 0.0f };
+		std::vector<float> mReadTimes;  // per AccessRecorder line, when it was last read
+		std::vector<float> mWriteTimes;
 
 	};
 
-} // namespace UI
\ No newline at end of file
+} // namespace UI
@@ -0,0 +1,144 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "PerformanceWindow.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+
+namespace UI
+{
+
+	struct MetricInfo
+	{
+		const char* Label;
+		const char* Format; // of the latest value, shown over the plot
+		float Scale;        // from the sampled unit to the shown one
+	};
+
+	constexpr MetricInfo METRICS[] = {
+		{ "Instructions",      "%.2f MIPS",       1e-6f },
+		{ "Clock",             "%.2f MHz",        1e-6f },
+		{ "Host time",         "%.1f ns/instr",   1.0f  },
+		{ "Bus reads",         "%.2f M/s",        1e-6f },
+		{ "Bus writes",        "%.2f M/s",        1e-6f },
+		{ "Listing row cache", "%.0f %% hits",    1.0f  },
+		{ "Frame time",        "%.2f ms",         1.0f  },
+		{ "Emulation thread",  "%.0f %% busy",    1.0f  },
+		{ "UI rendering",      "%.0f %% busy",    1.0f  }
+	};
+
+	static_assert(std::size(METRICS) == PerformanceWindow::METRIC_COUNT);
+
+	PerformanceWindow::PerformanceWindow(const i8086::EmulationThread* emulation, const disassembler::DisassemblerController* disassemblerController)
+		: mEmulation(emulation), mDisassemblerController(disassemblerController)
+	{
+		if (!mEmulation || !mDisassemblerController)
+		{
+			throw std::runtime_error("PerformanceWindow::PerformanceWindow -> Emulation thread or disassembler controller is not initialized");
+		}
+	}
+
+	void PerformanceWindow::RecordFrame(double frameSeconds, double renderSeconds)
+	{
+		mFrameSeconds += frameSeconds;
+		mRenderSeconds += renderSeconds;
+		++mFrames;
+
+		const double now = ImGui::GetTime();
+
+		if (now - mLastSampleTime >= SAMPLE_INTERVAL)
+		{
+			Sample(now - mLastSampleTime);
+			mLastSampleTime = now;
+		}
+	}
+
+	void PerformanceWindow::Sample(double seconds)
+	{
+		const i8086::EmulatorSnapshot& snapshot = mEmulation->GetSnapshot();
+
+		const Counters current{
+			snapshot.Instructions,
+			snapshot.Cycles,
+			snapshot.BusReads,
+			snapshot.BusWrites,
+			mDisassemblerController->GetRowCacheHits(),
+			mDisassemblerController->GetRowCacheMisses(),
+			snapshot.BusySeconds
+		};
+
+		const auto rate = [seconds](u64 now, u64 before) {
+			return static_cast<float>(static_cast<double>(now - before) / seconds);
+		};
+
+		const u64 instructions = current.Instructions - mLast.Instructions;
+		const u64 rowCalls = (current.RowCacheHits - mLast.RowCacheHits) + (current.RowCacheMisses - mLast.RowCacheMisses);
+		const double busy = current.BusySeconds - mLast.BusySeconds;
+
+		mSeries[InstructionsPerSecond].Push(rate(current.Instructions, mLast.Instructions));
+		mSeries[CyclesPerSecond].Push(rate(current.Cycles, mLast.Cycles));
+		mSeries[BusReadsPerSecond].Push(rate(current.BusReads, mLast.BusReads));
+		mSeries[BusWritesPerSecond].Push(rate(current.BusWrites, mLast.BusWrites));
+		mSeries[EmulationBusy].Push(static_cast<float>(100.0 * busy / seconds));
+
+		// without instructions or listing rows in the interval there is nothing to divide, the last value stays
+		mSeries[NsPerInstruction].Push(instructions ? static_cast<float>(busy * 1e9 / instructions) : mSeries[NsPerInstruction].Last());
+
+		mSeries[RowCacheHitRate].Push(rowCalls
+			? static_cast<float>(100.0 * (current.RowCacheHits - mLast.RowCacheHits) / rowCalls)
+			: mSeries[RowCacheHitRate].Last());
+
+		mSeries[FrameTime].Push(mFrames ? static_cast<float>(mFrameSeconds * 1e3 / mFrames) : 0.0f);
+		mSeries[RenderBusy].Push(static_cast<float>(100.0 * mRenderSeconds / seconds));
+
+		mLast = current;
+		mFrameSeconds = 0.0;
+		mRenderSeconds = 0.0;
+		mFrames = 0;
+	}
+
+	void PerformanceWindow::ShowIfOpen()
+	{
+		if (!mIsOpen)
+		{
+			return;
+		}
+
+		if (ImGui::Begin("Performance", &mIsOpen))
+		{
+			for (int metric = 0; metric < METRIC_COUNT; ++metric)
+			{
+				RenderSeries(static_cast<Metric>(metric));
+			}
+		}
+
+		ImGui::End();
+	}
+
+	void PerformanceWindow::RenderSeries(Metric metric) const
+	{
+		const MetricInfo& info = METRICS[metric];
+		const Series& series = mSeries[metric];
+
+		std::array<float, HISTORY> values;
+		std::transform(series.Values.begin(), series.Values.end(), values.begin(), [&](float value) { return value * info.Scale; });
+
+		char overlay[48];
+		snprintf(overlay, sizeof(overlay), info.Format, series.Last() * info.Scale);
+
+		const float maxValue = *std::max_element(values.begin(), values.end());
+
+		ImGui::PushID(metric);
+		ImGui::TextUnformatted(info.Label);
+		ImGui::PlotLines(
+			"##Plot", values.data(), static_cast<int>(HISTORY), static_cast<int>(series.Next),
+			overlay, 0.0f, std::max(maxValue * 1.1f, 1e-3f), ImVec2(-1.0f, 50.0f)
+		);
+		ImGui::PopID();
+	}
+
+} // namespace UI
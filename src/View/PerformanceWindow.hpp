@@ -0,0 +1,102 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Interfaces/IViewWindow.hpp>
+#include <Controller/DisassemblerController.hpp>
+#include <Model/EmulationThread.hpp>
+#include <Utils/types.hpp>
+
+#include <imgui.h>
+
+#include <array>
+
+namespace UI
+{
+
+	/**
+	 * @brief Rolling plots of emulator throughput and UI frame costs.
+	 *
+	 * @details
+	 * Every SAMPLE_INTERVAL the counters of the latest snapshot (instructions, cycles, bus
+	 * accesses, host time spent executing) and the frame times recorded since are turned into
+	 * rates. Sampling goes on while the window is closed, so opening it shows the recent past.
+	 */
+	class PerformanceWindow : public IViewWindow
+	{
+
+	public:
+
+		static constexpr size_t HISTORY = 240;
+		static constexpr double SAMPLE_INTERVAL = 0.25;
+
+		enum Metric
+		{
+			InstructionsPerSecond,
+			CyclesPerSecond,
+			NsPerInstruction,
+			BusReadsPerSecond,
+			BusWritesPerSecond,
+			RowCacheHitRate,
+			FrameTime,
+			EmulationBusy,
+			RenderBusy,
+			METRIC_COUNT
+		};
+
+		PerformanceWindow(const i8086::EmulationThread* emulation, const disassembler::DisassemblerController* disassemblerController);
+
+		/**
+		 * @brief Called once per frame with the host time of the previous frame and of its rendering.
+		 */
+		void RecordFrame(double frameSeconds, double renderSeconds);
+
+		void ShowIfOpen() override;
+
+	private:
+
+		struct Series
+		{
+			std::array<float, HISTORY> Values{};
+			size_t Next{ 0 };
+
+			void Push(float value)
+			{
+				Values[Next] = value;
+				Next = (Next + 1) % HISTORY;
+			}
+
+			float Last() const { return Values[(Next + HISTORY - 1) % HISTORY]; }
+		};
+
+		struct Counters
+		{
+			u64 Instructions{ 0 };
+			u64 Cycles{ 0 };
+			u64 BusReads{ 0 };
+			u64 BusWrites{ 0 };
+			u64 RowCacheHits{ 0 };
+			u64 RowCacheMisses{ 0 };
+			double BusySeconds{ 0.0 };
+		};
+
+		void Sample(double seconds);
+		void RenderSeries(Metric metric) const;
+
+	private:
+
+		const i8086::EmulationThread* const mEmulation{ nullptr };
+		const disassembler::DisassemblerController* const mDisassemblerController{ nullptr };
+
+		std::array<Series, METRIC_COUNT> mSeries;
+		Counters mLast;
+		double mLastSampleTime{ 0.0 };
+
+		double mFrameSeconds{ 0.0 };  // accumulated since the last sample
+		double mRenderSeconds{ 0.0 };
+		u32 mFrames{ 0 };
+	};
+
+} // namespace UI
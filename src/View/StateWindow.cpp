@@ -6,6 +6,7 @@
 
 #include <Utils/Panel.hpp>
 
+#include <algorithm>
 #include <bitset>
 
 namespace UI
@@ -34,6 +35,7 @@ namespace UI
 		{
 
 			mCPUController->GetState(mState);
+			CopyStack();
 			
 			ImGui::Separator();
 
@@ -41,7 +43,7 @@ namespace UI
 			Panel("##SegmentRegistersPanel", "Segment Registers", 105.0f, TITLE_BG_COL, [&]() { RenderSegmentRegisters(); });
 			Panel("##FlagsPanel", "Flags", 150.0f, TITLE_BG_COL, [&]() { RenderFlags(); });
 			Panel("##ModRMPanel", "ModR/M", 90.0f, TITLE_BG_COL, [&]() { RenderModRM(); });
-			Panel("##StackPanel", "Stack", 90.0f, TITLE_BG_COL, [&]() { RenderStack(); });
+			Panel("##StackPanel", "Stack", 140.0f, TITLE_BG_COL, [&]() { RenderStack(); });
 
 		}
 
@@ -145,22 +147,50 @@ namespace UI
 
 	}
 
+	void StateWindow::CopyStack()
+	{
+		// what was pushed since reset, bounded: after an underflow SP is above its initial value
+		// and the difference wraps to almost the whole segment
+		const u16 depth = mCPUInitialState.SP.X - mState.SP.X;
+		const u16 bytes = std::min<u16>(depth, STACK_VIEW_BYTES);
+
+		mStackWords = bytes / 2;
+
+		// one block copy per frame, in two parts if the stack wraps at the end of its segment
+		const u32 segmentBase = static_cast<u32>(mState.SS.X) << 4;
+		const u16 untilWrap = static_cast<u16>(std::min<u32>(bytes, 0x10000u - mState.SP.X));
+
+		mMemory->ReadBlock(segmentBase + mState.SP.X, { mStack.data(), untilWrap });
+
+		if (untilWrap < bytes)
+		{
+			mMemory->ReadBlock(segmentBase, { mStack.data() + untilWrap, static_cast<size_t>(bytes - untilWrap) });
+		}
+	}
+
 	inline void StateWindow::RenderStack() const
 	{
+		const float height = ImGui::GetTextLineHeightWithSpacing() * 12.0f;
 
-		if (ImGui::BeginTable("##StackTable", 2, TABLE_FLAGS)) {
+		if (ImGui::BeginTable("##StackTable", 2, TABLE_FLAGS | ImGuiTableFlags_ScrollY, { 0.0f, height })) {
 
-			const u16 stackSize = mCPUInitialState.SP.X - mState.SP.X;
+			ImGuiListClipper clipper;
+			clipper.Begin(mStackWords);
 
-			for (u16 i = 0; i <= stackSize; ++i)
+			while (clipper.Step())
 			{
-				ImGui::TableNextRow();
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+				{
+					const u16 value = static_cast<u16>(mStack[i * 2 + 1] << 8) | mStack[i * 2];
 
-				ImGui::TableNextColumn();
-				ImGui::Text(" %2d ", i);
+					ImGui::TableNextRow();
 
-				ImGui::TableNextColumn();
-				ImGui::Text(" 0x%02X ", mBus->Read(mCPUInitialState.SP.X - i, mState.SS, 8));
+					ImGui::TableNextColumn();
+					ImGui::Text(" %04X ", static_cast<u16>(mState.SP.X + i * 2));
+
+					ImGui::TableNextColumn();
+					ImGui::Text(" 0x%04X ", value);
+				}
 			}
 
 			ImGui::EndTable();
@@ -4,10 +4,12 @@
 
 #pragma once
 
-#include <Model/MemoryBus.hpp>
+#include <Interfaces/IMemorySource.hpp>
 #include <Controller/CPUController.hpp>
 #include <Interfaces/IViewWindow.hpp>
 
+#include <array>
+
 namespace UI
 {
 
@@ -16,8 +18,8 @@ namespace UI
 
 	public:
 
-		StateWindow(const i8086::CPUController* cpuController, const i8086::MemoryBus* bus) 
-		: mCPUController(cpuController), mBus(bus), mCPUInitialState(mCPUController->GetInitialState()) {};
+		StateWindow(const i8086::CPUController* cpuController, const i8086::IMemorySource* memory) 
+		: mCPUController(cpuController), mMemory(memory), mCPUInitialState(mCPUController->GetInitialState()) {};
 
 		void ShowIfOpen() override;
 
@@ -29,14 +31,21 @@ namespace UI
 		inline void RenderModRM() const;
 		inline void RenderStack() const;
 
+		void CopyStack();
+
 	private:
 
+		static constexpr u16 STACK_VIEW_BYTES = 512; // deepest part of the stack shown, from SS:SP up
+
 		const i8086::CPUController* const mCPUController{ nullptr };
-		const i8086::MemoryBus* const mBus { nullptr };
+		const i8086::IMemorySource* const mMemory { nullptr };
 
 		i8086::CPUState mState{};
 		const i8086::CPUState mCPUInitialState{};
 
+		std::array<u8, STACK_VIEW_BYTES> mStack{};
+		u16 mStackWords{ 0 };
+
 
 	};
 
@@ -0,0 +1,177 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "TextModeWindow.hpp"
+
+#include <stdexcept>
+
+namespace UI
+{
+
+	using i8086::TextModeAdapter;
+
+	constexpr std::array<ImU32, 16> CGA_PALETTE =
+	{
+		IM_COL32(0x00, 0x00, 0x00, 0xFF), IM_COL32(0x00, 0x00, 0xAA, 0xFF), IM_COL32(0x00, 0xAA, 0x00, 0xFF), IM_COL32(0x00, 0xAA, 0xAA, 0xFF),
+		IM_COL32(0xAA, 0x00, 0x00, 0xFF), IM_COL32(0xAA, 0x00, 0xAA, 0xFF), IM_COL32(0xAA, 0x55, 0x00, 0xFF), IM_COL32(0xAA, 0xAA, 0xAA, 0xFF),
+		IM_COL32(0x55, 0x55, 0x55, 0xFF), IM_COL32(0x55, 0x55, 0xFF, 0xFF), IM_COL32(0x55, 0xFF, 0x55, 0xFF), IM_COL32(0x55, 0xFF, 0xFF, 0xFF),
+		IM_COL32(0xFF, 0x55, 0x55, 0xFF), IM_COL32(0xFF, 0x55, 0xFF, 0xFF), IM_COL32(0xFF, 0xFF, 0x55, 0xFF), IM_COL32(0xFF, 0xFF, 0xFF, 0xFF)
+	};
+
+	constexpr ImU32 MDA_BLACK  = IM_COL32(0x00, 0x00, 0x00, 0xFF);
+	constexpr ImU32 MDA_NORMAL = IM_COL32(0x28, 0xB4, 0x3C, 0xFF);
+	constexpr ImU32 MDA_BRIGHT = IM_COL32(0x5A, 0xFF, 0x6E, 0xFF);
+
+	TextModeWindow::TextModeWindow(const i8086::TextModeAdapter* adapter, const i8086::EmulationThread* emulation)
+		: mAdapter(adapter), mEmulation(emulation)
+	{
+		if (!mAdapter || !mEmulation)
+		{
+			throw std::runtime_error("TextModeAdapter is not initialized.");
+		}
+	}
+
+	void TextModeWindow::ShowIfOpen()
+	{
+		const i8086::EmulatorSnapshot& snapshot = mEmulation->GetSnapshot();
+
+		// rows written while the window is closed are remembered, not converted
+		if (snapshot.Sequence != mLastSequence)
+		{
+			mDirtyRows |= snapshot.TextRowsChanged;
+			mLastSequence = snapshot.Sequence;
+		}
+
+		if (!mIsOpen)
+		{
+			return;
+		}
+
+		// only the rows touched since the last frame are converted again
+		for (u32 row = 0; row < TextModeAdapter::ROWS; ++row)
+		{
+			if (mDirtyRows & (1u << row))
+			{
+				RebuildRow(row);
+			}
+		}
+
+		mDirtyRows = 0;
+
+		if (ImGui::Begin("Display", &mIsOpen, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			RenderScreen();
+		}
+
+		ImGui::End();
+	}
+
+	inline void TextModeWindow::GetCellColors(u8 attribute, ImU32& foreground, ImU32& background) const
+	{
+		if (mAdapter->GetMode() == i8086::TextMode::CGA)
+		{
+			foreground = CGA_PALETTE[attribute & 0x0F];
+			background = CGA_PALETTE[(attribute >> 4) & 0x07];
+			return;
+		}
+
+		background = MDA_BLACK;
+
+		switch (attribute & 0x77)
+		{
+		case 0x00:
+			foreground = MDA_BLACK;
+			break;
+
+		case 0x70:
+			foreground = MDA_BLACK;
+			background = MDA_NORMAL;
+			break;
+
+		default:
+			foreground = (attribute & 0x08) ? MDA_BRIGHT : MDA_NORMAL;
+			break;
+		}
+	}
+
+	inline void TextModeWindow::RebuildRow(u32 row)
+	{
+		auto& runs = mRows[row];
+		size_t runCount = 0;
+
+		char utf8[4];
+
+		// cells are a character byte and an attribute byte, read from the snapshot the UI holds
+		std::array<u8, TextModeAdapter::COLUMNS * 2> cells;
+		mEmulation->GetMemory()->ReadBlock(mAdapter->GetBaseAddress() + row * TextModeAdapter::COLUMNS * 2, cells);
+
+		for (u32 column = 0; column < TextModeAdapter::COLUMNS; ++column)
+		{
+			ImU32 foreground{};
+			ImU32 background{};
+
+			GetCellColors(cells[column * 2 + 1], foreground, background);
+
+			const bool startsRun = (runCount == 0)
+				|| runs[runCount - 1].Foreground != foreground
+				|| runs[runCount - 1].Background != background;
+
+			if (startsRun)
+			{
+				// runs are reused between rebuilds, keeping their string buffers
+				if (runCount == runs.size())
+				{
+					runs.emplace_back();
+				}
+
+				TextRun& run = runs[runCount++];
+				run.Column = column;
+				run.Length = 0;
+				run.Foreground = foreground;
+				run.Background = background;
+				run.Text.clear();
+			}
+
+			TextRun& run = runs[runCount - 1];
+			run.Length++;
+			run.Text.append(utf8, TextModeAdapter::GlyphToUTF8(cells[column * 2], utf8));
+		}
+
+		mRunCounts[row] = runCount;
+	}
+
+	inline void TextModeWindow::RenderScreen() const
+	{
+		const float cellWidth = ImGui::CalcTextSize("W").x;
+		const float cellHeight = ImGui::GetTextLineHeight();
+
+		const ImVec2 origin = ImGui::GetCursorScreenPos();
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+		drawList->AddRectFilled(origin,
+			ImVec2(origin.x + cellWidth * TextModeAdapter::COLUMNS, origin.y + cellHeight * TextModeAdapter::ROWS),
+			CGA_PALETTE[0]);
+
+		for (u32 row = 0; row < TextModeAdapter::ROWS; ++row)
+		{
+			const float y = origin.y + cellHeight * row;
+
+			for (size_t i = 0; i < mRunCounts[row]; ++i)
+			{
+				const TextRun& run = mRows[row][i];
+				const ImVec2 runPos(origin.x + cellWidth * run.Column, y);
+
+				if (run.Background != CGA_PALETTE[0])
+				{
+					drawList->AddRectFilled(runPos, ImVec2(runPos.x + cellWidth * run.Length, y + cellHeight), run.Background);
+				}
+
+				drawList->AddText(runPos, run.Foreground, run.Text.data(), run.Text.data() + run.Text.size());
+			}
+		}
+
+		ImGui::Dummy(ImVec2(cellWidth * TextModeAdapter::COLUMNS, cellHeight * TextModeAdapter::ROWS));
+	}
+
+} // namespace UI
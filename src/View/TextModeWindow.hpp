@@ -0,0 +1,58 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Interfaces/IViewWindow.hpp>
+#include <Model/EmulationThread.hpp>
+#include <Model/TextModeAdapter.hpp>
+#include <Utils/types.hpp>
+
+#include <imgui.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace UI
+{
+
+	class TextModeWindow : public IViewWindow
+	{
+
+	public:
+
+		TextModeWindow(const i8086::TextModeAdapter* adapter, const i8086::EmulationThread* emulation);
+
+		void ShowIfOpen() override;
+
+	private:
+
+		// Consecutive cells sharing the same colors, drawn with a single text call
+		struct TextRun
+		{
+			u32 Column{};
+			u32 Length{};
+			ImU32 Foreground{};
+			ImU32 Background{};
+			std::string Text;
+		};
+
+		inline void RebuildRow(u32 row);
+		inline void RenderScreen() const;
+		inline void GetCellColors(u8 attribute, ImU32& foreground, ImU32& background) const;
+
+	private:
+
+		const i8086::TextModeAdapter* const mAdapter{ nullptr };
+		const i8086::EmulationThread* const mEmulation{ nullptr };
+
+		u64 mLastSequence{ 0 };
+		u32 mDirtyRows{ (1u << i8086::TextModeAdapter::ROWS) - 1 };
+
+		std::array<std::vector<TextRun>, i8086::TextModeAdapter::ROWS> mRows;
+		std::array<size_t, i8086::TextModeAdapter::ROWS> mRunCounts{};
+	};
+
+} // namespace UI
@@ -0,0 +1,191 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#include "TraceWindow.hpp"
+
+#include <cstdio>
+#include <span>
+#include <stdexcept>
+
+namespace UI
+{
+
+	using i8086::ExecutionTrace;
+	using i8086::ExecutionTraceEntry;
+
+	constexpr ImGuiTableFlags TABLE_FLAGS = ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+
+	TraceWindow::TraceWindow(i8086::EmulationThread* emulation) : mEmulation(emulation)
+	{
+		if (!mEmulation)
+		{
+			throw std::runtime_error("TraceWindow::TraceWindow -> Emulation thread is not initialized");
+		}
+	}
+
+	void TraceWindow::ShowIfOpen()
+	{
+		if (!mIsOpen)
+		{
+			return;
+		}
+
+		const i8086::EmulatorSnapshot& snapshot = mEmulation->GetSnapshot();
+
+		if (ImGui::Begin("Trace", &mIsOpen))
+		{
+			bool tracing = snapshot.Tracing;
+
+			if (ImGui::Checkbox("Record", &tracing))
+			{
+				mEmulation->RecordExecution(tracing);
+			}
+
+			ImGui::SameLine();
+			ImGui::TextDisabled("%llu instructions recorded, last %zu kept", static_cast<unsigned long long>(snapshot.TraceRecorded), ExecutionTrace::DEFAULT_CAPACITY);
+
+			ImGui::Separator();
+
+			if (snapshot.Running)
+			{
+				ImGui::TextUnformatted("Pause the emulation to inspect the trace.");
+			}
+
+			else
+			{
+				RenderTrace(snapshot);
+			}
+		}
+
+		ImGui::End();
+	}
+
+	void TraceWindow::RenderTrace(const i8086::EmulatorSnapshot& snapshot)
+	{
+		const auto& trace = snapshot.Trace;
+
+		if (!ImGui::BeginTable("##TraceTable", 5, TABLE_FLAGS))
+		{
+			return;
+		}
+
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("#", ImGuiTableColumnFlags_WidthFixed, ImGui::CalcTextSize("0000000000").x);
+		ImGui::TableSetupColumn("Address", ImGuiTableColumnFlags_WidthFixed, ImGui::CalcTextSize("0000:0000").x);
+		ImGui::TableSetupColumn("Bytes", ImGuiTableColumnFlags_WidthFixed, ImGui::CalcTextSize("00 00 00 00 00 00").x);
+		ImGui::TableSetupColumn("Instruction");
+		ImGui::TableSetupColumn("Changed");
+		ImGui::TableHeadersRow();
+
+		// number of the oldest kept entry among all those recorded
+		const u64 firstNumber = snapshot.TraceRecorded - trace.size();
+
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(trace.size()), ImGui::GetTextLineHeightWithSpacing());
+
+		while (clipper.Step())
+		{
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+			{
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::Text("%llu", static_cast<unsigned long long>(firstNumber + row));
+
+				RenderRow(trace[row], row > 0 ? &trace[row - 1] : nullptr);
+			}
+		}
+
+		clipper.End();
+
+		// a new trace opens on its latest instructions
+		if (mShownRecorded != snapshot.TraceRecorded)
+		{
+			mShownRecorded = snapshot.TraceRecorded;
+			ImGui::SetScrollHereY(1.0f);
+		}
+
+		ImGui::EndTable();
+	}
+
+	void TraceWindow::RenderRow(const ExecutionTraceEntry& entry, const ExecutionTraceEntry* previous)
+	{
+		ImGui::TableNextColumn();
+		ImGui::Text("%04X:%04X", entry.CS, entry.IP);
+
+		ImGui::TableNextColumn();
+
+		char bytes[3 * ExecutionTraceEntry::MAX_BYTES + 1] = {};
+
+		for (u8 i = 0; i < entry.Length; ++i)
+		{
+			snprintf(bytes + 3 * i, sizeof(bytes) - 3 * i, "%02X ", entry.Bytes[i]);
+		}
+
+		ImGui::TextUnformatted(bytes);
+
+		ImGui::TableNextColumn();
+		FormatInstruction(entry);
+		ImGui::TextUnformatted(mText.data(), mText.data() + mText.size());
+
+		// what the first kept instruction changed is unknown, the entry before it was overwritten
+		ImGui::TableNextColumn();
+
+		if (previous)
+		{
+			FormatChanges(entry, *previous);
+			ImGui::TextUnformatted(mText.data(), mText.data() + mText.size());
+		}
+	}
+
+	void TraceWindow::FormatInstruction(const ExecutionTraceEntry& entry)
+	{
+		const u32 address = entry.GetAddress();
+
+		mDisassembler.SetSource(std::span<const u8>(entry.Bytes.data(), entry.Length), address);
+
+		disassembler::Instruction instr = mDisassembler.DecodeAt(address);
+
+		mTokenArena.Clear();
+		mDisassembler.Format(instr, mTokenArena);
+
+		mText.clear();
+
+		for (const auto& token : mTokenArena.GetTokens(instr.Tokens))
+		{
+			mText += mTokenArena.GetText(token);
+
+			if (token.HasSpace)
+			{
+				mText += ' ';
+			}
+		}
+	}
+
+	void TraceWindow::FormatChanges(const ExecutionTraceEntry& entry, const ExecutionTraceEntry& previous)
+	{
+		const u16 changed = ExecutionTrace::GetChangedRegisters(previous, entry);
+
+		mText.clear();
+
+		for (size_t i = 0; i < ExecutionTraceEntry::REGISTER_COUNT; ++i)
+		{
+			if (changed & (1u << i))
+			{
+				char text[16];
+				snprintf(text, sizeof(text), "%s=%04X ", ExecutionTrace::REGISTER_NAMES[i], entry.Registers[i]);
+
+				mText += text;
+			}
+		}
+
+		if (changed & ExecutionTrace::FLAGS_CHANGED)
+		{
+			char text[16];
+			snprintf(text, sizeof(text), "FL=%04X", entry.Flags);
+
+			mText += text;
+		}
+	}
+
+} // namespace UI
@@ -0,0 +1,55 @@
+// i86emu - Intel 8086 emulator
+// Copyright (c) 2025 Mateus Duarte
+// Licensed under the MIT License. See LICENSE file for details.
+
+#pragma once
+
+#include <Interfaces/IViewWindow.hpp>
+#include <Model/Disassembler.hpp>
+#include <Model/EmulationThread.hpp>
+#include <Model/ExecutionTrace.hpp>
+#include <Model/Token.hpp>
+
+#include <imgui.h>
+
+#include <string>
+
+namespace UI
+{
+
+	/**
+	 * @brief Listing of the last executed instructions, from the execution trace of the latest snapshot.
+	 *
+	 * @details
+	 * The trace arrives with the snapshots published while the machine is stopped. Only the
+	 * visible rows are disassembled, from the bytes kept in their entry, and each row lists
+	 * the registers its instruction changed.
+	 */
+	class TraceWindow : public IViewWindow
+	{
+
+	public:
+
+		TraceWindow(i8086::EmulationThread* emulation);
+
+		void ShowIfOpen() override;
+
+	private:
+
+		void RenderTrace(const i8086::EmulatorSnapshot& snapshot);
+		void RenderRow(const i8086::ExecutionTraceEntry& entry, const i8086::ExecutionTraceEntry* previous);
+		void FormatInstruction(const i8086::ExecutionTraceEntry& entry);
+		void FormatChanges(const i8086::ExecutionTraceEntry& entry, const i8086::ExecutionTraceEntry& previous);
+
+	private:
+
+		i8086::EmulationThread* const mEmulation{ nullptr };
+
+		disassembler::Disassembler mDisassembler;
+		disassembler::TokenArena mTokenArena;
+		std::string mText; // of the row being drawn
+
+		u64 mShownRecorded{ 0 }; // TraceRecorded of the trace last shown, a new one scrolls to its end
+	};
+
+} // namespace UI
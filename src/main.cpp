@@ -4,13 +4,9 @@
 
 #include <Core/EmulatorApp.hpp>
 
-#include <filesystem>
-
 int main(int argc, char** argv)
 {
 
-    std::filesystem::current_path(std::filesystem::path(__FILE__).parent_path().parent_path());
-
     EmulatorApp app;
 
     app.Run();